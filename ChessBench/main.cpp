@@ -0,0 +1,216 @@
+#include "Perft.h"
+#include "BitboardPosition.h"
+#include "Nnue.h"
+
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static const std::string START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -";
+
+// Board uses lowercase letters for white, uppercase for black and 'h' for the knight //
+static bool ParseFen(const std::string& fen, CharBoard& board, EColor& turn, CastleValues& castle, int& enPassantSquare)
+{
+	std::istringstream stream(fen);
+	std::string placement, side, castling, enPassant;
+	stream >> placement >> side >> castling >> enPassant;
+
+	for (auto& row : board)
+		row.fill(' ');
+
+	int row = 0, col = 0;
+	for (char c : placement)
+	{
+		if (c == '/')
+		{
+			row++;
+			col = 0;
+		}
+		else if (c >= '1' && c <= '8')
+		{
+			col += c - '0';
+		}
+		else
+		{
+			if (row > 7 || col > 7)
+				return false;
+
+			char piece = (char)std::tolower(c) == 'n' ? 'h' : (char)std::tolower(c);
+			board[row][col++] = std::islower(c) ? (char)std::toupper(piece) : piece;
+		}
+	}
+	if (row != 7 || col != 8)
+		return false;
+
+	if (side != "w" && side != "b")
+		return false;
+	turn = side == "w" ? EColor::White : EColor::Black;
+
+	castle = { false, false, false, false };
+	for (char c : castling)
+	{
+		switch (c)
+		{
+		case 'K': castle[(int)EColor::White][(int)ESide::Kingside] = true; break;
+		case 'Q': castle[(int)EColor::White][(int)ESide::Queenside] = true; break;
+		case 'k': castle[(int)EColor::Black][(int)ESide::Kingside] = true; break;
+		case 'q': castle[(int)EColor::Black][(int)ESide::Queenside] = true; break;
+		default: break;
+		}
+	}
+
+	// Only the rank behind a pawn that just moved two squares can hold the en passant square //
+	enPassantSquare = -1;
+	if (!enPassant.empty() && enPassant != "-")
+	{
+		char rank = turn == EColor::White ? '6' : '3';
+		if (enPassant.size() != 2 || enPassant[0] < 'a' || enPassant[0] > 'h' || enPassant[1] != rank)
+			return false;
+		enPassantSquare = ('8' - enPassant[1]) * 8 + (enPassant[0] - 'a');
+	}
+	return true;
+}
+
+static void PrintUsage()
+{
+	std::cout << "Usage:\n"
+		<< "  ChessBench perft <depth> [fen]\n"
+		<< "  ChessBench divide <depth> [fen]\n"
+		<< "  ChessBench nnue <network file> [fen]\n";
+}
+
+// Evaluates the positions up to two plies from the board with every kernel the CPU supports //
+static int RunNnueBench(const std::string& networkFile, const CharBoard& board, EColor turn, const CastleValues& castle, int enPassantSquare)
+{
+	const int EVALUATIONS = 4000000;
+
+	auto network = Nnue::Network::Load(networkFile);
+	if (!network)
+	{
+		std::cout << "Invalid network file: " << networkFile << "\n";
+		return 1;
+	}
+
+	Nnue::Accumulator accumulator(*network);
+	BitboardPosition position(board, turn, castle, enPassantSquare);
+	position.SetAccumulator(&accumulator);
+
+	std::vector<std::pair<Nnue::Accumulator, EColor>> positions;
+	positions.push_back({ accumulator, position.GetTurn() });
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+	for (const auto& move : moves)
+	{
+		UndoInfo undo = position.MakeMove(move);
+		positions.push_back({ accumulator, position.GetTurn() });
+
+		FixedMoveList replies;
+		position.GenerateLegalMoves(replies);
+		for (const auto& reply : replies)
+		{
+			UndoInfo replyUndo = position.MakeMove(reply);
+			positions.push_back({ accumulator, position.GetTurn() });
+			position.UnmakeMove(replyUndo);
+		}
+		position.UnmakeMove(undo);
+	}
+
+	std::cout << "Positions: " << positions.size() << "\n";
+
+	for (Nnue::EKernel kernel : { Nnue::EKernel::Scalar, Nnue::EKernel::Sse41, Nnue::EKernel::Avx2 })
+	{
+		if (!Nnue::IsKernelSupported(kernel))
+		{
+			std::cout << Nnue::GetKernelName(kernel) << ": not supported\n";
+			continue;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		std::int64_t checksum = 0;
+
+		for (int i = 0; i < EVALUATIONS; i++)
+		{
+			const auto& entry = positions[i % positions.size()];
+			checksum += entry.first.Evaluate(entry.second, kernel);
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+		// The checksum is printed so the evaluations can not be optimized away //
+		std::cout << Nnue::GetKernelName(kernel) << ": "
+			<< (elapsed > 0 ? EVALUATIONS * 1000000ll / elapsed : EVALUATIONS) << " evaluations/s"
+			<< " (checksum " << checksum << ")\n";
+	}
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::string command = argv[1];
+
+	std::string fen = START_FEN;
+	if (argc > 3)
+	{
+		fen.clear();
+		for (int i = 3; i < argc; i++)
+			fen += std::string(argv[i]) + " ";
+	}
+
+	CharBoard board;
+	EColor turn;
+	CastleValues castle;
+	int enPassantSquare;
+	if (!ParseFen(fen, board, turn, castle, enPassantSquare))
+	{
+		std::cout << "Invalid FEN: " << fen << "\n";
+		return 1;
+	}
+
+	if (command == "nnue")
+	{
+		return RunNnueBench(argv[2], board, turn, castle, enPassantSquare);
+	}
+
+	int depth = std::stoi(argv[2]);
+	Perft perft(board, turn, castle, enPassantSquare);
+
+	auto start = std::chrono::steady_clock::now();
+	std::uint64_t nodes = 0;
+
+	if (command == "perft")
+	{
+		nodes = perft.Run(depth);
+	}
+	else if (command == "divide")
+	{
+		for (const auto& moveNodes : perft.Divide(depth))
+		{
+			std::cout << moveNodes.first << ": " << moveNodes.second << "\n";
+			nodes += moveNodes.second;
+		}
+		std::cout << "\n";
+	}
+	else
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << "Nodes: " << nodes << "\n"
+		<< "Time: " << elapsed << " ms\n"
+		<< "NPS: " << (elapsed > 0 ? nodes * 1000 / elapsed : nodes) << "\n";
+
+	return 0;
+}
@@ -0,0 +1,176 @@
+#include "AlgebraicNotation.h"
+#include "Piece.h"
+
+static const std::string TABLE_COLUMNS("abcdefgh");
+static const std::string TABLE_ROWS("87654321");
+
+// ---		Local Static Functions													--- //
+
+static bool IsFile(char c)
+{
+	return c >= 'a' && c <= 'h';
+}
+
+static bool IsRank(char c)
+{
+	return c >= '1' && c <= '8';
+}
+
+static bool IsCapture(Move move)
+{
+	return move.GetFlag() == EMoveFlag::Capture || move.GetFlag() == EMoveFlag::EnPassant;
+}
+
+static char ToPieceLetter(EType type)
+{
+	switch (type)
+	{
+	case EType::Rook:
+		return 'R';
+	case EType::Horse:
+		return 'N';
+	case EType::Bishop:
+		return 'B';
+	case EType::Queen:
+		return 'Q';
+	case EType::King:
+		return 'K';
+	default:
+		return 'P';
+	}
+}
+
+static bool IsPieceLetter(char c)
+{
+	return c == 'R' || c == 'N' || c == 'B' || c == 'Q' || c == 'K';
+}
+
+static bool ParseCastle(std::string_view notation, const FixedMoveList& legalMoves, Move& move)
+{
+	int toCol = notation.size() == 3 ? 6 : 2;
+	for (const auto& legalMove : legalMoves)
+	{
+		if (legalMove.GetFlag() == EMoveFlag::Castle && legalMove.GetTo() % 8 == toCol)
+		{
+			move = legalMove;
+			return true;
+		}
+	}
+	return false;
+}
+
+// ------------------------------------------------------------------------------------ //
+
+bool AlgebraicNotation::ParseMove(std::string_view notation, const BitboardPosition& position, const FixedMoveList& legalMoves, Move& move)
+{
+	std::size_t end = notation.find_last_not_of("+#!?");
+	if (end == std::string_view::npos)
+		return false;
+	notation = notation.substr(0, end + 1);
+
+	if (notation == "O-O" || notation == "0-0" || notation == "O-O-O" || notation == "0-0-0")
+		return ParseCastle(notation, legalMoves, move);
+
+	EType promotion = EType::Pawn;
+	if (IsPieceLetter(notation.back()) && notation.back() != 'K')
+	{
+		promotion = Piece::GetTypeFromLetter(notation.back());
+		notation.remove_suffix(1);
+		if (!notation.empty() && notation.back() == '=')
+			notation.remove_suffix(1);
+	}
+
+	if (notation.size() < 2 || !IsFile(notation[notation.size() - 2]) || !IsRank(notation.back()))
+		return false;
+
+	int to = (int)TABLE_ROWS.find(notation.back()) * 8 + (notation[notation.size() - 2] - 'a');
+	notation.remove_suffix(2);
+
+	EType type = EType::Pawn;
+	if (!notation.empty() && IsPieceLetter(notation.front()))
+	{
+		type = Piece::GetTypeFromLetter(notation.front());
+		notation.remove_prefix(1);
+	}
+
+	// What is left can only be the file or rank of the piece and the capture mark //
+	int fromCol = -1;
+	int fromRow = -1;
+	for (char c : notation)
+	{
+		if (IsFile(c))
+			fromCol = c - 'a';
+		else if (IsRank(c))
+			fromRow = (int)TABLE_ROWS.find(c);
+		else if (c != 'x' && c != '-')
+			return false;
+	}
+
+	int matches = 0;
+	for (const auto& legalMove : legalMoves)
+	{
+		int from = legalMove.GetFrom();
+		if (legalMove.GetTo() != to || legalMove.GetPromotion() != promotion || position.GetType(from) != type)
+			continue;
+		if ((fromCol != -1 && from % 8 != fromCol) || (fromRow != -1 && from / 8 != fromRow))
+			continue;
+
+		move = legalMove;
+		matches++;
+	}
+	return matches == 1;
+}
+
+std::string AlgebraicNotation::MoveToString(Move move, const BitboardPosition& position, const FixedMoveList& legalMoves)
+{
+	if (move.GetFlag() == EMoveFlag::Castle)
+		return move.GetTo() % 8 == 6 ? "0-0" : "0-0-0";
+
+	int from = move.GetFrom();
+	int to = move.GetTo();
+	EType type = position.GetType(from);
+
+	std::string notation;
+	if (type == EType::Pawn)
+	{
+		if (IsCapture(move))
+			notation += TABLE_COLUMNS[from % 8];
+	}
+	else
+	{
+		notation += ToPieceLetter(type);
+
+		bool ambiguous = false;
+		bool sameCol = false;
+		bool sameRow = false;
+		for (const auto& legalMove : legalMoves)
+		{
+			int otherFrom = legalMove.GetFrom();
+			if (legalMove.GetTo() != to || otherFrom == from || position.GetType(otherFrom) != type)
+				continue;
+
+			ambiguous = true;
+			sameCol |= otherFrom % 8 == from % 8;
+			sameRow |= otherFrom / 8 == from / 8;
+		}
+
+		// The file is enough unless the other piece is on the same file //
+		if (ambiguous && (!sameCol || sameRow))
+			notation += TABLE_COLUMNS[from % 8];
+		if (sameCol)
+			notation += TABLE_ROWS[from / 8];
+	}
+
+	if (IsCapture(move))
+		notation += 'x';
+
+	notation += TABLE_COLUMNS[to % 8];
+	notation += TABLE_ROWS[to / 8];
+
+	if (move.GetPromotion() != EType::Pawn)
+	{
+		notation += '=';
+		notation += ToPieceLetter(move.GetPromotion());
+	}
+	return notation;
+}
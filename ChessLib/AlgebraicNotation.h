@@ -0,0 +1,21 @@
+#pragma once
+
+#include "BitboardPosition.h"
+
+#include <string>
+#include <string_view>
+
+// Standard algebraic notation read and written against the legal moves of one position, so a move is
+// resolved or disambiguated with a single pass over a list generated once.
+// Castles are written 0-0 and 0-0-0. Check marks are left to the caller, they depend on the next position.
+class AlgebraicNotation
+{
+public:
+	// Finds the only legal move the notation can mean, false when there is none or more than one.
+	// Captures may be written with or without x, castles with O or 0 and upgrades as e8=Q or e8Q;
+	// check marks and annotations after the move are ignored //
+	static bool ParseMove(std::string_view notation, const BitboardPosition& position, const FixedMoveList& legalMoves, Move& move);
+
+	// The file or rank of the piece is only written when another piece of its type can move to the same square //
+	static std::string MoveToString(Move move, const BitboardPosition& position, const FixedMoveList& legalMoves);
+};
@@ -0,0 +1,232 @@
+#include "Bitboard.h"
+
+#include <vector>
+
+namespace Bitboards
+{
+	std::array<std::array<Bitboard, 64>, 2> PawnAttacks;
+	std::array<Bitboard, 64> HorseAttacks;
+	std::array<Bitboard, 64> KingAttacks;
+	std::array<std::array<Bitboard, 64>, 8> Rays;
+	std::array<std::array<Bitboard, 64>, 64> Between;
+	std::array<std::array<Bitboard, 64>, 64> Lines;
+	std::array<Magic, 64> RookMagics;
+	std::array<Magic, 64> BishopMagics;
+}
+
+// ---		Local Static Functions													--- //
+
+static const std::array<Position, 8> DIRECTIONS = {
+	Position(-1,  0),	// North
+	Position( 1,  0),	// South
+	Position( 0,  1),	// East
+	Position( 0, -1),	// West
+	Position(-1,  1),	// NorthEast
+	Position(-1, -1),	// NorthWest
+	Position( 1,  1),	// SouthEast
+	Position( 1, -1)	// SouthWest
+};
+
+static const std::array<int, 8> OPPOSITE_DIRECTIONS = {
+	Bitboards::South, Bitboards::North, Bitboards::West, Bitboards::East,
+	Bitboards::SouthWest, Bitboards::SouthEast, Bitboards::NorthWest, Bitboards::NorthEast
+};
+
+static bool IsOnBoard(int row, int col)
+{
+	return row >= 0 && row < 8 && col >= 0 && col < 8;
+}
+
+static Bitboard GetLeaperAttacks(int square, const std::array<Position, 8>& offsets, int count)
+{
+	Position pos = ToPosition(square);
+	Bitboard attacks = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		int row = pos.row + offsets[i].row;
+		int col = pos.col + offsets[i].col;
+		if (IsOnBoard(row, col))
+		{
+			attacks |= SquareBB(row * 8 + col);
+		}
+	}
+	return attacks;
+}
+
+// Blockers on rays that go towards higher squares are found with the lowest bit,
+// blockers on the other rays with the highest one.
+static bool IsPositiveDirection(int direction)
+{
+	return direction == Bitboards::South || direction == Bitboards::East
+		|| direction == Bitboards::SouthEast || direction == Bitboards::SouthWest;
+}
+
+static Bitboard GetRayAttacks(int square, int direction, Bitboard occupancy)
+{
+	Bitboard attacks = Bitboards::Rays[direction][square];
+	Bitboard blockers = attacks & occupancy;
+
+	if (blockers)
+	{
+		int blocker = IsPositiveDirection(direction) ? Lsb(blockers) : Msb(blockers);
+		attacks ^= Bitboards::Rays[direction][blocker];
+	}
+	return attacks;
+}
+
+static const std::array<int, 4> ROOK_DIRECTIONS = {
+	Bitboards::North, Bitboards::South, Bitboards::East, Bitboards::West
+};
+
+static const std::array<int, 4> BISHOP_DIRECTIONS = {
+	Bitboards::NorthEast, Bitboards::NorthWest, Bitboards::SouthEast, Bitboards::SouthWest
+};
+
+// Every rook table has at most 2^12 entries and every bishop table at most 2^9, but most squares need
+// far less, so the tables of all the squares share one array
+static std::array<Bitboard, 0x19000> s_rookTable;
+static std::array<Bitboard, 0x1480> s_bishopTable;
+
+static Bitboard GetSlidingAttacks(int square, const std::array<int, 4>& directions, Bitboard occupancy)
+{
+	Bitboard attacks = 0;
+	for (int direction : directions)
+	{
+		attacks |= GetRayAttacks(square, direction, occupancy);
+	}
+	return attacks;
+}
+
+// Fixed seed, so the magics found are the same on every run //
+static Bitboard NextRandom(Bitboard& state)
+{
+	state ^= state >> 12;
+	state ^= state << 25;
+	state ^= state >> 27;
+	return state * 0x2545F4914F6CDD1D;
+}
+
+static void InitMagics(std::array<Bitboards::Magic, 64>& magics, Bitboard* table, const std::array<int, 4>& directions)
+{
+	std::vector<Bitboard> occupancies;
+	std::vector<Bitboard> references;
+	std::vector<int> epoch(4096, 0);
+	int attempt = 0;
+	Bitboard state = 0x9E3779B97F4A7C15;
+
+	for (int square = 0; square < 64; square++)
+	{
+		Position pos = ToPosition(square);
+		Bitboard edges = ((Bitboards::RowMask(0) | Bitboards::RowMask(7)) & ~Bitboards::RowMask(pos.row))
+			| ((Bitboards::ColMask(0) | Bitboards::ColMask(7)) & ~Bitboards::ColMask(pos.col));
+
+		Bitboards::Magic& m = magics[square];
+		m.mask = GetSlidingAttacks(square, directions, 0) & ~edges;
+		m.shift = 64 - PopCount(m.mask);
+		m.magic = 0;
+		m.attacks = table;
+
+		// Every subset of the mask, enumerated with the carry-rippler trick //
+		occupancies.clear();
+		references.clear();
+		Bitboard subset = 0;
+		do
+		{
+			occupancies.push_back(subset);
+			references.push_back(GetSlidingAttacks(square, directions, subset));
+			subset = (subset - m.mask) & m.mask;
+		} while (subset);
+
+		Bitboard* attacks = table;
+		table += occupancies.size();
+
+#if defined(CHESS_USE_PEXT)
+		for (int i = 0; i < (int)occupancies.size(); i++)
+		{
+			attacks[m.Index(occupancies[i])] = references[i];
+		}
+#else
+		bool found = false;
+		while (!found)
+		{
+			// Sparse candidates are much more likely to be magic //
+			m.magic = NextRandom(state) & NextRandom(state) & NextRandom(state);
+			if (PopCount((m.mask * m.magic) >> 56) < 6)
+				continue;
+
+			// The epoch tells which entries were written by this attempt, so nothing has to be cleared //
+			attempt++;
+			found = true;
+			for (int i = 0; i < (int)occupancies.size() && found; i++)
+			{
+				unsigned index = m.Index(occupancies[i]);
+				if (epoch[index] < attempt)
+				{
+					epoch[index] = attempt;
+					attacks[index] = references[i];
+				}
+				else if (attacks[index] != references[i])
+				{
+					found = false;
+				}
+			}
+		}
+#endif
+	}
+}
+
+static struct BitboardInitializer
+{
+	BitboardInitializer()
+	{
+		const std::array<Position, 8> HORSE_OFFSETS = {
+			Position(-2, -1), Position(-2, 1), Position(-1, -2), Position(-1, 2),
+			Position( 1, -2), Position( 1, 2), Position( 2, -1), Position( 2, 1)
+		};
+		const std::array<Position, 8> WHITE_PAWN_OFFSETS = { Position(-1, -1), Position(-1, 1) };
+		const std::array<Position, 8> BLACK_PAWN_OFFSETS = { Position( 1, -1), Position( 1, 1) };
+
+		for (int square = 0; square < 64; square++)
+		{
+			Bitboards::HorseAttacks[square] = GetLeaperAttacks(square, HORSE_OFFSETS, 8);
+			Bitboards::KingAttacks[square] = GetLeaperAttacks(square, DIRECTIONS, 8);
+			Bitboards::PawnAttacks[0][square] = GetLeaperAttacks(square, WHITE_PAWN_OFFSETS, 2);
+			Bitboards::PawnAttacks[1][square] = GetLeaperAttacks(square, BLACK_PAWN_OFFSETS, 2);
+
+			Position pos = ToPosition(square);
+			for (int direction = 0; direction < 8; direction++)
+			{
+				Bitboard ray = 0;
+				for (int row = pos.row + DIRECTIONS[direction].row, col = pos.col + DIRECTIONS[direction].col
+					; IsOnBoard(row, col)
+					; row += DIRECTIONS[direction].row, col += DIRECTIONS[direction].col)
+				{
+					ray |= SquareBB(row * 8 + col);
+				}
+				Bitboards::Rays[direction][square] = ray;
+			}
+		}
+
+		// Needs all the rays, so it is done in a second pass //
+		for (int square = 0; square < 64; square++)
+		{
+			for (int direction = 0; direction < 8; direction++)
+			{
+				Bitboard ray = Bitboards::Rays[direction][square];
+				Bitboard line = ray | Bitboards::Rays[OPPOSITE_DIRECTIONS[direction]][square] | SquareBB(square);
+
+				while (ray)
+				{
+					int target = PopLsb(ray);
+					Bitboards::Between[square][target] = Bitboards::Rays[direction][square]
+						& ~Bitboards::Rays[direction][target] & ~SquareBB(target);
+					Bitboards::Lines[square][target] = line;
+				}
+			}
+		}
+
+		InitMagics(Bitboards::RookMagics, s_rookTable.data(), ROOK_DIRECTIONS);
+		InitMagics(Bitboards::BishopMagics, s_bishopTable.data(), BISHOP_DIRECTIONS);
+	}
+} s_initializer;
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Position.h"
+
+#include <array>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// PEXT extracts the blockers of a slider in one instruction on CPUs with BMI2,
+// other builds index the same tables with a magic multiplication
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define CHESS_USE_PEXT
+#include <immintrin.h>
+#endif
+
+// Squares are numbered row * 8 + col, so square 0 is the top left corner of the
+// board (a8) and square 63 is the bottom right one (h1), same as Position.
+
+using Bitboard = std::uint64_t;
+
+inline int ToSquare(Position pos)
+{
+	return pos.row * 8 + pos.col;
+}
+
+inline Position ToPosition(int square)
+{
+	return Position(square / 8, square % 8);
+}
+
+inline Bitboard SquareBB(int square)
+{
+	return Bitboard(1) << square;
+}
+
+inline int PopCount(Bitboard bb)
+{
+#if defined(_MSC_VER)
+	return (int)__popcnt64(bb);
+#else
+	return __builtin_popcountll(bb);
+#endif
+}
+
+inline int Lsb(Bitboard bb)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward64(&index, bb);
+	return (int)index;
+#else
+	return __builtin_ctzll(bb);
+#endif
+}
+
+inline int Msb(Bitboard bb)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanReverse64(&index, bb);
+	return (int)index;
+#else
+	return 63 - __builtin_clzll(bb);
+#endif
+}
+
+inline int PopLsb(Bitboard& bb)
+{
+	int square = Lsb(bb);
+	bb &= bb - 1;
+	return square;
+}
+
+namespace Bitboards
+{
+	enum EDirection
+	{
+		North,
+		South,
+		East,
+		West,
+		NorthEast,
+		NorthWest,
+		SouthEast,
+		SouthWest
+	};
+
+	constexpr Bitboard RowMask(int row)
+	{
+		return Bitboard(0xFF) << (row * 8);
+	}
+
+	constexpr Bitboard ColMask(int col)
+	{
+		return Bitboard(0x0101010101010101) << col;
+	}
+
+	extern std::array<std::array<Bitboard, 64>, 2> PawnAttacks;    // indexed by EColor
+	extern std::array<Bitboard, 64> HorseAttacks;
+	extern std::array<Bitboard, 64> KingAttacks;
+	extern std::array<std::array<Bitboard, 64>, 8> Rays;           // indexed by EDirection
+	extern std::array<std::array<Bitboard, 64>, 64> Between;       // squares strictly between two aligned squares
+	extern std::array<std::array<Bitboard, 64>, 64> Lines;         // whole line through two aligned squares
+
+	// Attacks of a slider on one square, looked up by the pieces on its lines except the board edges //
+	struct Magic
+	{
+		Bitboard mask;			// squares whose occupancy changes the attacks
+		Bitboard magic;			// unused with PEXT
+		const Bitboard* attacks;
+		int shift;				// 64 minus the number of bits of mask
+
+		unsigned Index(Bitboard occupancy) const
+		{
+#if defined(CHESS_USE_PEXT)
+			return (unsigned)_pext_u64(occupancy, mask);
+#else
+			return (unsigned)(((occupancy & mask) * magic) >> shift);
+#endif
+		}
+	};
+
+	extern std::array<Magic, 64> RookMagics;
+	extern std::array<Magic, 64> BishopMagics;
+
+	inline Bitboard RookAttacks(int square, Bitboard occupancy)
+	{
+		const Magic& m = RookMagics[square];
+		return m.attacks[m.Index(occupancy)];
+	}
+
+	inline Bitboard BishopAttacks(int square, Bitboard occupancy)
+	{
+		const Magic& m = BishopMagics[square];
+		return m.attacks[m.Index(occupancy)];
+	}
+
+	inline Bitboard QueenAttacks(int square, Bitboard occupancy)
+	{
+		return RookAttacks(square, occupancy) | BishopAttacks(square, occupancy);
+	}
+}
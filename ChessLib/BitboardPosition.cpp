@@ -0,0 +1,928 @@
+#include "BitboardPosition.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+// ---		Local Static Functions													--- //
+
+static EType GetTypeFromChar(char c)
+{
+	// white pieces: p r h b q k
+	// black pieces: P R H B Q K
+
+	static const EType types[] = { EType::Pawn, EType::Rook, EType::Horse, EType::Bishop, EType::Queen, EType::King };
+
+	std::string str = "prhbqk";
+	int pos = str.find_first_of(tolower(c));
+
+	return types[pos];
+}
+
+static EColor GetColorFromChar(char c)
+{
+	return islower(c) ? EColor::White : EColor::Black;
+}
+
+// The king is worth more than everything else, so it never takes a defended piece //
+static int GetExchangeValue(EType type)
+{
+	return type == EType::King ? 20000 : Evaluation::PieceValues[(int)type];
+}
+
+// Cheapest first //
+static const std::array<EType, 6> EXCHANGE_ORDER = { EType::Pawn, EType::Horse, EType::Bishop, EType::Rook, EType::Queen, EType::King };
+
+// ------------------------------------------------------------------------------------ //
+
+BitboardPosition::BitboardPosition()
+	: m_turn(EColor::White)
+	, m_castle({ false, false, false, false })
+	, m_enPassantSquare(-1)
+	, m_key(0)
+	, m_middlegameScore(0)
+	, m_endgameScore(0)
+	, m_phase(0)
+	, m_accumulator(nullptr)
+{
+	Clear();
+}
+
+BitboardPosition::BitboardPosition(const CharBoard& board, EColor turn, const CastleValues& castle, int enPassantSquare /*= -1*/)
+	: m_turn(turn)
+	, m_castle(castle)
+	, m_enPassantSquare(-1)
+	, m_key(0)
+	, m_middlegameScore(0)
+	, m_endgameScore(0)
+	, m_phase(0)
+	, m_accumulator(nullptr)
+{
+	Clear();
+
+	for (int i = 0; i < 8; i++)
+	{
+		for (int j = 0; j < 8; j++)
+		{
+			if (board[i][j] != ' ')
+			{
+				SetPiece(i * 8 + j, GetTypeFromChar(board[i][j]), GetColorFromChar(board[i][j]));
+			}
+		}
+	}
+	m_enPassantSquare = enPassantSquare;
+	m_key = ComputeKey();
+}
+
+void BitboardPosition::Clear()
+{
+	for (auto& colorPieces : m_pieces)
+		colorPieces.fill(0);
+
+	m_occupancy.fill(0);
+	m_allOccupancy = 0;
+	m_enPassantSquare = -1;
+	m_key = ComputeKey();
+
+	m_middlegameScore = 0;
+	m_endgameScore = 0;
+	m_phase = 0;
+
+	if (m_accumulator)
+		m_accumulator->Clear();
+}
+
+void BitboardPosition::SetPiece(int square, EType type, EColor color)
+{
+	Bitboard bb = SquareBB(square);
+
+	m_pieces[(int)color][(int)type] |= bb;
+	m_occupancy[(int)color] |= bb;
+	m_allOccupancy |= bb;
+
+	m_key ^= Zobrist::Pieces[(int)color][(int)type][square];
+
+	m_middlegameScore += Evaluation::Middlegame[(int)color][(int)type][square];
+	m_endgameScore += Evaluation::Endgame[(int)color][(int)type][square];
+	m_phase += Evaluation::Phase[(int)type];
+
+	if (m_accumulator)
+		m_accumulator->AddPiece(color, type, square);
+}
+
+void BitboardPosition::RemovePiece(int square)
+{
+	Bitboard bb = SquareBB(square);
+
+	if (!(m_allOccupancy & bb))
+		return;
+
+	EColor color = GetColor(square);
+	EType type = GetType(square);
+
+	m_key ^= Zobrist::Pieces[(int)color][(int)type][square];
+
+	m_middlegameScore -= Evaluation::Middlegame[(int)color][(int)type][square];
+	m_endgameScore -= Evaluation::Endgame[(int)color][(int)type][square];
+	m_phase -= Evaluation::Phase[(int)type];
+
+	if (m_accumulator)
+		m_accumulator->RemovePiece(color, type, square);
+
+	for (auto& colorPieces : m_pieces)
+		for (auto& pieces : colorPieces)
+			pieces &= ~bb;
+
+	m_occupancy[0] &= ~bb;
+	m_occupancy[1] &= ~bb;
+	m_allOccupancy &= ~bb;
+}
+
+void BitboardPosition::MovePiece(int from, int to)
+{
+	EType type = GetType(from);
+	EColor color = GetColor(from);
+
+	RemovePiece(from);
+	SetPiece(to, type, color);
+}
+
+bool BitboardPosition::IsEmpty(int square) const
+{
+	return !(m_allOccupancy & SquareBB(square));
+}
+
+EColor BitboardPosition::GetColor(int square) const
+{
+	return (m_occupancy[(int)EColor::White] & SquareBB(square)) ? EColor::White : EColor::Black;
+}
+
+EType BitboardPosition::GetType(int square) const
+{
+	const auto& colorPieces = m_pieces[(int)GetColor(square)];
+
+	for (int type = 0; type < 6; type++)
+	{
+		if (colorPieces[type] & SquareBB(square))
+			return (EType)type;
+	}
+	return EType::Pawn;
+}
+
+Bitboard BitboardPosition::GetPieces(EColor color, EType type) const
+{
+	return m_pieces[(int)color][(int)type];
+}
+
+Bitboard BitboardPosition::GetOccupancy(EColor color) const
+{
+	return m_occupancy[(int)color];
+}
+
+Bitboard BitboardPosition::GetOccupancy() const
+{
+	return m_allOccupancy;
+}
+
+EColor BitboardPosition::GetTurn() const
+{
+	return m_turn;
+}
+
+void BitboardPosition::SetTurn(EColor turn)
+{
+	if (turn != m_turn)
+	{
+		m_key ^= Zobrist::BlackToMove;
+	}
+	m_turn = turn;
+}
+
+bool BitboardPosition::IsCastlingAvailable(EColor color, ESide side) const
+{
+	return m_castle[(int)color][(int)side];
+}
+
+const CastleValues& BitboardPosition::GetCastle() const
+{
+	return m_castle;
+}
+
+void BitboardPosition::SetCastle(const CastleValues& castle)
+{
+	for (int color = 0; color < 2; color++)
+	{
+		for (int side = 0; side < 2; side++)
+		{
+			if (m_castle[color][side] != castle[color][side])
+				m_key ^= Zobrist::Castle[color][side];
+		}
+	}
+	m_castle = castle;
+}
+
+void BitboardPosition::DisableCastle(EColor color, ESide side)
+{
+	if (m_castle[(int)color][(int)side])
+	{
+		m_key ^= Zobrist::Castle[(int)color][(int)side];
+		m_castle[(int)color][(int)side] = false;
+	}
+}
+
+int BitboardPosition::GetEnPassantSquare() const
+{
+	return m_enPassantSquare;
+}
+
+bool BitboardPosition::IsEnPassant(int from, int to) const
+{
+	return to == m_enPassantSquare && (m_pieces[(int)m_turn][(int)EType::Pawn] & SquareBB(from));
+}
+
+int BitboardPosition::GetKingSquare(EColor color) const
+{
+	Bitboard king = m_pieces[(int)color][(int)EType::King];
+	return king ? Lsb(king) : -1;
+}
+
+std::uint64_t BitboardPosition::GetKey() const
+{
+	return m_key;
+}
+
+std::uint64_t BitboardPosition::ComputeKey() const
+{
+	std::uint64_t key = 0;
+
+	for (int color = 0; color < 2; color++)
+	{
+		for (int type = 0; type < 6; type++)
+		{
+			Bitboard pieces = m_pieces[color][type];
+			while (pieces)
+			{
+				key ^= Zobrist::Pieces[color][type][PopLsb(pieces)];
+			}
+		}
+
+		for (int side = 0; side < 2; side++)
+		{
+			if (m_castle[color][side])
+				key ^= Zobrist::Castle[color][side];
+		}
+	}
+
+	if (m_enPassantSquare != -1)
+		key ^= Zobrist::EnPassant[m_enPassantSquare % 8];
+
+	if (m_turn == EColor::Black)
+		key ^= Zobrist::BlackToMove;
+
+	return key;
+}
+
+int BitboardPosition::Evaluate() const
+{
+	if (m_accumulator)
+		return m_accumulator->Evaluate(m_turn);
+
+	int score = Evaluation::Taper(m_middlegameScore, m_endgameScore, m_phase);
+
+	return m_turn == EColor::White ? score : -score;
+}
+
+int BitboardPosition::ComputeEvaluation() const
+{
+	if (m_accumulator)
+	{
+		Nnue::Accumulator accumulator(m_accumulator->GetNetwork());
+
+		for (int color = 0; color < 2; color++)
+		{
+			for (int type = 0; type < 6; type++)
+			{
+				Bitboard pieces = m_pieces[color][type];
+				while (pieces)
+				{
+					accumulator.AddPiece((EColor)color, (EType)type, PopLsb(pieces));
+				}
+			}
+		}
+		return accumulator.Evaluate(m_turn);
+	}
+
+	int middlegame = 0, endgame = 0, phase = 0;
+
+	for (int color = 0; color < 2; color++)
+	{
+		for (int type = 0; type < 6; type++)
+		{
+			Bitboard pieces = m_pieces[color][type];
+			while (pieces)
+			{
+				int square = PopLsb(pieces);
+
+				middlegame += Evaluation::Middlegame[color][type][square];
+				endgame += Evaluation::Endgame[color][type][square];
+				phase += Evaluation::Phase[type];
+			}
+		}
+	}
+
+	int score = Evaluation::Taper(middlegame, endgame, phase);
+
+	return m_turn == EColor::White ? score : -score;
+}
+
+void BitboardPosition::SetAccumulator(Nnue::Accumulator* accumulator)
+{
+	m_accumulator = accumulator;
+
+	if (!m_accumulator)
+		return;
+
+	m_accumulator->Clear();
+
+	for (int color = 0; color < 2; color++)
+	{
+		for (int type = 0; type < 6; type++)
+		{
+			Bitboard pieces = m_pieces[color][type];
+			while (pieces)
+			{
+				m_accumulator->AddPiece((EColor)color, (EType)type, PopLsb(pieces));
+			}
+		}
+	}
+}
+
+Bitboard BitboardPosition::GetAttackersTo(int square, EColor attackerColor, Bitboard occupancy) const
+{
+	const auto& pieces = m_pieces[(int)attackerColor];
+
+	Bitboard straightSliders = pieces[(int)EType::Rook] | pieces[(int)EType::Queen];
+	Bitboard diagonalSliders = pieces[(int)EType::Bishop] | pieces[(int)EType::Queen];
+
+	return (Bitboards::PawnAttacks[(int)Opponent(attackerColor)][square] & pieces[(int)EType::Pawn])
+		| (Bitboards::HorseAttacks[square] & pieces[(int)EType::Horse])
+		| (Bitboards::KingAttacks[square] & pieces[(int)EType::King])
+		| (Bitboards::RookAttacks(square, occupancy) & straightSliders)
+		| (Bitboards::BishopAttacks(square, occupancy) & diagonalSliders);
+}
+
+bool BitboardPosition::IsAttacked(int square, EColor attackerColor) const
+{
+	return GetAttackersTo(square, attackerColor, m_allOccupancy) != 0;
+}
+
+bool BitboardPosition::IsInCheck(EColor color) const
+{
+	int kingSquare = GetKingSquare(color);
+	return kingSquare != -1 && IsAttacked(kingSquare, Opponent(color));
+}
+
+void BitboardPosition::ComputeAttackMap(AttackMap& attackMap) const
+{
+	attackMap.attacked.fill(0);
+
+	for (int square = 0; square < 64; square++)
+	{
+		Bitboard whiteAttackers = GetAttackersTo(square, EColor::White, m_allOccupancy);
+		Bitboard blackAttackers = GetAttackersTo(square, EColor::Black, m_allOccupancy);
+
+		if (whiteAttackers)
+			attackMap.attacked[(int)EColor::White] |= SquareBB(square);
+		if (blackAttackers)
+			attackMap.attacked[(int)EColor::Black] |= SquareBB(square);
+
+		attackMap.attackers[square] = whiteAttackers | blackAttackers;
+	}
+}
+
+Bitboard BitboardPosition::GetLegalTargets(int from) const
+{
+	if (!(m_occupancy[(int)m_turn] & SquareBB(from)))
+		return 0;
+
+	return GetLegalTargets(from, GetCheckInfo());
+}
+
+bool BitboardPosition::HasLegalMove() const
+{
+	CheckInfo info = GetCheckInfo();
+	Bitboard ownPieces = m_occupancy[(int)m_turn];
+
+	while (ownPieces)
+	{
+		if (GetLegalTargets(PopLsb(ownPieces), info))
+			return true;
+	}
+	return false;
+}
+
+void BitboardPosition::GenerateLegalMoves(FixedMoveList& moves, EMoveKind kind /*= EMoveKind::All*/) const
+{
+	CheckInfo info = GetCheckInfo();
+	Bitboard ownPieces = m_occupancy[(int)m_turn];
+	Bitboard pawns = m_pieces[(int)m_turn][(int)EType::Pawn];
+
+	// Pawns also capture on the en passant square and count every move to the last row //
+	Bitboard captureTargets = m_occupancy[(int)Opponent(m_turn)];
+	Bitboard pawnCaptureTargets = captureTargets | Bitboards::RowMask(m_turn == EColor::White ? 0 : 7)
+		| (m_enPassantSquare != -1 ? SquareBB(m_enPassantSquare) : 0);
+
+	while (ownPieces)
+	{
+		int from = PopLsb(ownPieces);
+		Bitboard targets = GetLegalTargets(from, info);
+
+		if (kind != EMoveKind::All)
+		{
+			Bitboard captures = (pawns & SquareBB(from)) ? pawnCaptureTargets : captureTargets;
+			targets &= kind == EMoveKind::Captures ? captures : ~captures;
+		}
+		AddMoves(from, targets, moves);
+	}
+}
+
+void BitboardPosition::GenerateLegalMoves(int from, FixedMoveList& moves) const
+{
+	AddMoves(from, GetLegalTargets(from), moves);
+}
+
+bool BitboardPosition::IsLegal(Move move) const
+{
+	int from = move.GetFrom();
+	int to = move.GetTo();
+
+	if (!(GetLegalTargets(from) & SquareBB(to)) || move.GetFlag() != GetMoveFlag(from, to))
+		return false;
+
+	// A stored move may come from another position, where the same squares made an upgrade or not //
+	bool upgrade = (m_pieces[(int)m_turn][(int)EType::Pawn] & SquareBB(from))
+		&& (SquareBB(to) & Bitboards::RowMask(m_turn == EColor::White ? 0 : 7));
+
+	return upgrade == (move.GetPromotion() != EType::Pawn);
+}
+
+int BitboardPosition::StaticExchange(Move move) const
+{
+	int from = move.GetFrom();
+	int to = move.GetTo();
+	EMoveFlag flag = move.GetFlag();
+
+	if (flag == EMoveFlag::Castle)
+		return 0;
+
+	// gains[i] is what the side making capture i wins if the exchange stops after it //
+	std::array<int, 32> gains;
+	int depth = 0;
+
+	Bitboard occupancy = m_allOccupancy & ~SquareBB(from);
+	EType attackerType = GetType(from);
+
+	if (flag == EMoveFlag::EnPassant)
+	{
+		gains[0] = GetExchangeValue(EType::Pawn);
+		occupancy &= ~SquareBB(m_turn == EColor::White ? to + 8 : to - 8);
+	}
+	else
+	{
+		gains[0] = flag == EMoveFlag::Capture ? GetExchangeValue(GetType(to)) : 0;
+	}
+
+	if (move.GetPromotion() != EType::Pawn)
+	{
+		gains[0] += GetExchangeValue(move.GetPromotion()) - GetExchangeValue(EType::Pawn);
+		attackerType = move.GetPromotion();
+	}
+
+	Bitboard straightSliders = m_pieces[0][(int)EType::Rook] | m_pieces[1][(int)EType::Rook]
+		| m_pieces[0][(int)EType::Queen] | m_pieces[1][(int)EType::Queen];
+	Bitboard diagonalSliders = m_pieces[0][(int)EType::Bishop] | m_pieces[1][(int)EType::Bishop]
+		| m_pieces[0][(int)EType::Queen] | m_pieces[1][(int)EType::Queen];
+
+	Bitboard attackers = (GetAttackersTo(to, EColor::White, occupancy) | GetAttackersTo(to, EColor::Black, occupancy)) & occupancy;
+	EColor side = Opponent(m_turn);
+
+	while (depth < (int)gains.size() - 1)
+	{
+		Bitboard sideAttackers = attackers & m_occupancy[(int)side];
+		if (!sideAttackers)
+			break;
+
+		int square = -1;
+		EType type = EType::Pawn;
+		for (EType candidate : EXCHANGE_ORDER)
+		{
+			Bitboard pieces = sideAttackers & m_pieces[(int)side][(int)candidate];
+			if (pieces)
+			{
+				square = Lsb(pieces);
+				type = candidate;
+				break;
+			}
+		}
+
+		// The piece standing on the square is taken back //
+		depth++;
+		gains[depth] = GetExchangeValue(attackerType) - gains[depth - 1];
+
+		// Removing the piece uncovers the sliders behind it //
+		occupancy &= ~SquareBB(square);
+		attackers |= (Bitboards::RookAttacks(to, occupancy) & straightSliders)
+			| (Bitboards::BishopAttacks(to, occupancy) & diagonalSliders);
+		attackers &= occupancy;
+
+		attackerType = type;
+		side = Opponent(side);
+	}
+
+	// Each side only takes back when that is better than stopping //
+	while (depth > 0)
+	{
+		gains[depth - 1] = -std::max(-gains[depth - 1], gains[depth]);
+		depth--;
+	}
+	return gains[0];
+}
+
+UndoInfo BitboardPosition::MakeMove(int from, int to, EType promotion /*= EType::Pawn*/)
+{
+	return MakeMove(Move(from, to, GetMoveFlag(from, to), promotion));
+}
+
+UndoInfo BitboardPosition::MakeMove(Move move)
+{
+	EColor color = m_turn;
+	int from = move.GetFrom();
+	int to = move.GetTo();
+	EMoveFlag flag = move.GetFlag();
+	EType type = GetType(from);
+
+	UndoInfo undo = { move, type, EType::Pawn, -1, m_castle, m_enPassantSquare, m_key };
+
+	if (flag == EMoveFlag::EnPassant)
+	{
+		undo.capturedSquare = color == EColor::White ? to + 8 : to - 8;
+	}
+	else if (flag == EMoveFlag::Capture)
+	{
+		undo.capturedSquare = to;
+	}
+
+	if (undo.capturedSquare != -1)
+	{
+		undo.capturedType = GetType(undo.capturedSquare);
+		RemovePiece(undo.capturedSquare);
+	}
+	MovePiece(from, to);
+
+	SetEnPassantSquare(-1);
+
+	if (move.GetPromotion() != EType::Pawn)
+	{
+		RemovePiece(to);
+		SetPiece(to, move.GetPromotion(), color);
+	}
+	else if (flag == EMoveFlag::DoublePawnPush)
+	{
+		// Only remember the square if an enemy pawn is there to take it //
+		int passedSquare = (from + to) / 2;
+		if (Bitboards::PawnAttacks[(int)color][passedSquare] & m_pieces[(int)Opponent(color)][(int)EType::Pawn])
+			SetEnPassantSquare(passedSquare);
+	}
+	else if (type == EType::King)
+	{
+		DisableCastle(color, ESide::Queenside);
+		DisableCastle(color, ESide::Kingside);
+
+		if (flag == EMoveFlag::Castle)
+		{
+			if (to > from)
+				MovePiece(from + 3, from + 1);
+			else
+				MovePiece(from - 4, from - 1);
+		}
+	}
+
+	UpdateCastleRights(from);
+	UpdateCastleRights(to);
+
+	SetTurn(Opponent(color));
+
+	return undo;
+}
+
+void BitboardPosition::UnmakeMove(const UndoInfo& undo)
+{
+	EColor color = Opponent(m_turn);
+	int from = undo.move.GetFrom();
+	int to = undo.move.GetTo();
+
+	if (undo.move.GetFlag() == EMoveFlag::Castle)
+	{
+		if (to > from)
+			MovePiece(from + 1, from + 3);
+		else
+			MovePiece(from - 1, from - 4);
+	}
+
+	// Removing the piece also takes back a promotion //
+	RemovePiece(to);
+	SetPiece(from, undo.movedType, color);
+
+	if (undo.capturedSquare != -1)
+	{
+		SetPiece(undo.capturedSquare, undo.capturedType, m_turn);
+	}
+
+	m_castle = undo.castle;
+	m_enPassantSquare = undo.enPassantSquare;
+	m_turn = color;
+	m_key = undo.key;
+}
+
+BitboardPosition::CheckInfo BitboardPosition::GetCheckInfo() const
+{
+	EColor color = m_turn;
+	EColor enemy = Opponent(color);
+
+	CheckInfo info = { GetKingSquare(color), 0, 0, ~Bitboard(0) };
+	if (info.kingSquare == -1)
+		return info;
+
+	info.checkers = GetAttackersTo(info.kingSquare, enemy, m_allOccupancy);
+	if (info.checkers)
+	{
+		// In double check only the king can move //
+		info.evasionMask = PopCount(info.checkers) > 1
+			? 0
+			: Bitboards::Between[info.kingSquare][Lsb(info.checkers)] | info.checkers;
+	}
+
+	// Enemy sliders that would attack the king if one own piece was removed pin that piece //
+	const auto& enemyPieces = m_pieces[(int)enemy];
+	Bitboard snipers = (Bitboards::RookAttacks(info.kingSquare, m_occupancy[(int)enemy])
+		& (enemyPieces[(int)EType::Rook] | enemyPieces[(int)EType::Queen]))
+		| (Bitboards::BishopAttacks(info.kingSquare, m_occupancy[(int)enemy])
+		& (enemyPieces[(int)EType::Bishop] | enemyPieces[(int)EType::Queen]));
+
+	while (snipers)
+	{
+		Bitboard blockers = Bitboards::Between[info.kingSquare][PopLsb(snipers)] & m_allOccupancy;
+		if (PopCount(blockers) == 1 && (blockers & m_occupancy[(int)color]))
+		{
+			info.pinned |= blockers;
+		}
+	}
+
+	return info;
+}
+
+Bitboard BitboardPosition::GetLegalTargets(int from, const CheckInfo& info) const
+{
+	if (from == info.kingSquare)
+	{
+		return GetKingTargets(from);
+	}
+
+	Bitboard targets = GetPseudoLegalTargets(from);
+
+	// En passant removes a piece away from the target square, so it is checked on its own //
+	bool enPassant = m_enPassantSquare != -1
+		&& (targets & SquareBB(m_enPassantSquare))
+		&& (m_pieces[(int)m_turn][(int)EType::Pawn] & SquareBB(from));
+	if (enPassant)
+	{
+		targets &= ~SquareBB(m_enPassantSquare);
+	}
+
+	targets &= info.evasionMask;
+
+	if (info.pinned & SquareBB(from))
+	{
+		targets &= Bitboards::Lines[info.kingSquare][from];
+	}
+
+	if (enPassant && LeavesKingSafe(from, m_enPassantSquare))
+	{
+		targets |= SquareBB(m_enPassantSquare);
+	}
+
+	return targets;
+}
+
+Bitboard BitboardPosition::GetKingTargets(int kingSquare) const
+{
+	EColor enemy = Opponent(m_turn);
+
+	// The king must not stay on the line of a slider that attacks it, so it is not a blocker //
+	Bitboard occupancy = m_allOccupancy & ~SquareBB(kingSquare);
+	Bitboard targets = Bitboards::KingAttacks[kingSquare] & ~m_occupancy[(int)m_turn];
+	Bitboard legal = 0;
+
+	while (targets)
+	{
+		int to = PopLsb(targets);
+		if (!GetAttackersTo(to, enemy, occupancy))
+		{
+			legal |= SquareBB(to);
+		}
+	}
+
+	return legal | GetCastleTargets(kingSquare);
+}
+
+Bitboard BitboardPosition::GetPseudoLegalTargets(int from) const
+{
+	EColor color = GetColor(from);
+	Bitboard notOwn = ~m_occupancy[(int)color];
+	Bitboard enemies = m_occupancy[(int)Opponent(color)];
+
+	switch (GetType(from))
+	{
+	case EType::Pawn:
+	{
+		Bitboard targets = Bitboards::PawnAttacks[(int)color][from] & enemies;
+
+		if (m_enPassantSquare != -1)
+		{
+			targets |= Bitboards::PawnAttacks[(int)color][from] & SquareBB(m_enPassantSquare);
+		}
+
+		int movingWay = color == EColor::White ? -8 : 8;
+		int initialRow = color == EColor::White ? 6 : 1;
+		int oneSquareForward = from + movingWay;
+
+		if (oneSquareForward >= 0 && oneSquareForward < 64 && IsEmpty(oneSquareForward))
+		{
+			targets |= SquareBB(oneSquareForward);
+
+			int twoSquaresForward = oneSquareForward + movingWay;
+			if (from / 8 == initialRow && IsEmpty(twoSquaresForward))
+			{
+				targets |= SquareBB(twoSquaresForward);
+			}
+		}
+		return targets;
+	}
+	case EType::Horse:
+		return Bitboards::HorseAttacks[from] & notOwn;
+	case EType::King:
+		return Bitboards::KingAttacks[from] & notOwn;
+	case EType::Rook:
+		return Bitboards::RookAttacks(from, m_allOccupancy) & notOwn;
+	case EType::Bishop:
+		return Bitboards::BishopAttacks(from, m_allOccupancy) & notOwn;
+	case EType::Queen:
+		return Bitboards::QueenAttacks(from, m_allOccupancy) & notOwn;
+	}
+	return 0;
+}
+
+Bitboard BitboardPosition::GetCastleTargets(int kingSquare) const
+{
+	EColor color = m_turn;
+	EColor enemy = Opponent(color);
+	int homeRow = color == EColor::White ? 7 : 0;
+
+	if (kingSquare != homeRow * 8 + 4 || IsAttacked(kingSquare, enemy))
+		return 0;
+
+	// The king must not pass through an attacked square, so its own square is not a blocker //
+	Bitboard occupancy = m_allOccupancy & ~SquareBB(kingSquare);
+	Bitboard rooks = m_pieces[(int)color][(int)EType::Rook];
+	Bitboard targets = 0;
+
+	// Left Castle //
+
+	if (m_castle[(int)color][(int)ESide::Queenside] && (rooks & SquareBB(homeRow * 8)))
+	{
+		Bitboard between = SquareBB(kingSquare - 1) | SquareBB(kingSquare - 2) | SquareBB(kingSquare - 3);
+
+		if (!(m_allOccupancy & between)
+			&& !GetAttackersTo(kingSquare - 1, enemy, occupancy)
+			&& !GetAttackersTo(kingSquare - 2, enemy, occupancy))
+		{
+			targets |= SquareBB(kingSquare - 2);
+		}
+	}
+
+	// Right Castle //
+
+	if (m_castle[(int)color][(int)ESide::Kingside] && (rooks & SquareBB(homeRow * 8 + 7)))
+	{
+		Bitboard between = SquareBB(kingSquare + 1) | SquareBB(kingSquare + 2);
+
+		if (!(m_allOccupancy & between)
+			&& !GetAttackersTo(kingSquare + 1, enemy, occupancy)
+			&& !GetAttackersTo(kingSquare + 2, enemy, occupancy))
+		{
+			targets |= SquareBB(kingSquare + 2);
+		}
+	}
+
+	return targets;
+}
+
+void BitboardPosition::AddMoves(int from, Bitboard targets, FixedMoveList& moves) const
+{
+	static const EType PROMOTION_TYPES[] = { EType::Queen, EType::Rook, EType::Bishop, EType::Horse };
+
+	bool upgrade = (m_pieces[(int)m_turn][(int)EType::Pawn] & SquareBB(from))
+		&& (targets & Bitboards::RowMask(m_turn == EColor::White ? 0 : 7));
+
+	while (targets)
+	{
+		int to = PopLsb(targets);
+		EMoveFlag flag = GetMoveFlag(from, to);
+
+		if (upgrade)
+		{
+			for (EType type : PROMOTION_TYPES)
+				moves.push_back(Move(from, to, flag, type));
+		}
+		else
+		{
+			moves.push_back(Move(from, to, flag));
+		}
+	}
+}
+
+bool BitboardPosition::LeavesKingSafe(int from, int to) const
+{
+	EColor color = m_turn;
+
+	// The board is not touched: the attackers are searched with the occupancy the move would leave //
+	Bitboard captured = SquareBB(IsEnPassant(from, to) ? (color == EColor::White ? to + 8 : to - 8) : to);
+	Bitboard occupancy = (m_allOccupancy & ~SquareBB(from) & ~captured) | SquareBB(to);
+
+	int kingSquare = (m_pieces[(int)color][(int)EType::King] & SquareBB(from)) ? to : GetKingSquare(color);
+	if (kingSquare == -1)
+		return true;
+
+	return !(GetAttackersTo(kingSquare, Opponent(color), occupancy) & ~captured);
+}
+
+EMoveFlag BitboardPosition::GetMoveFlag(int from, int to) const
+{
+	if (!IsEmpty(to))
+		return EMoveFlag::Capture;
+
+	switch (GetType(from))
+	{
+	case EType::Pawn:
+		if (to == m_enPassantSquare)
+			return EMoveFlag::EnPassant;
+		if (to - from == 16 || from - to == 16)
+			return EMoveFlag::DoublePawnPush;
+		break;
+	case EType::King:
+		if (to - from == 2 || from - to == 2)
+			return EMoveFlag::Castle;
+		break;
+	default:
+		break;
+	}
+	return EMoveFlag::Quiet;
+}
+
+void BitboardPosition::UpdateCastleRights(int square)
+{
+	// A move from or to a corner means the rook there moved or was captured //
+	switch (square)
+	{
+	case 0:
+		DisableCastle(EColor::Black, ESide::Queenside);
+		break;
+	case 7:
+		DisableCastle(EColor::Black, ESide::Kingside);
+		break;
+	case 56:
+		DisableCastle(EColor::White, ESide::Queenside);
+		break;
+	case 63:
+		DisableCastle(EColor::White, ESide::Kingside);
+		break;
+	default:
+		break;
+	}
+}
+
+void BitboardPosition::SetEnPassantSquare(int square)
+{
+	if (m_enPassantSquare != -1)
+		m_key ^= Zobrist::EnPassant[m_enPassantSquare % 8];
+
+	m_enPassantSquare = square;
+
+	if (m_enPassantSquare != -1)
+		m_key ^= Zobrist::EnPassant[m_enPassantSquare % 8];
+}
+
+EColor BitboardPosition::Opponent(EColor color)
+{
+	return color == EColor::White ? EColor::Black : EColor::White;
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Bitboard.h"
+#include "Zobrist.h"
+#include "Evaluation.h"
+#include "Nnue.h"
+#include "IChessGameControl.h"
+#include "Move.h"
+
+// What MakeMove can not recompute, kept so UnmakeMove can restore the previous position
+struct UndoInfo
+{
+	Move move;
+	EType movedType;
+	EType capturedType;
+	int capturedSquare;		// -1 when nothing was captured
+	CastleValues castle;
+	int enPassantSquare;
+	std::uint64_t key;
+};
+
+// Which legal moves GenerateLegalMoves lists: captures with en passant and every upgrade, or all the others
+enum class EMoveKind
+{
+	All,
+	Captures,
+	Quiets
+};
+
+// Squares attacked by each color and the pieces attacking every square of one position.
+// A square counts as attacked whatever stands on it, so defended pieces are attacked too
+struct AttackMap
+{
+	std::array<Bitboard, 2> attacked;	// indexed by EColor
+	std::array<Bitboard, 64> attackers;	// pieces of both colors
+};
+
+// Board state kept as one bitboard per piece type and color plus the occupancy masks,
+// used by ChessGame for move generation and attack detection.
+class BitboardPosition
+{
+public:
+	BitboardPosition();
+	// The en passant square is the one passed over by a double pawn push on the move before, -1 for none //
+	BitboardPosition(const CharBoard& board, EColor turn, const CastleValues& castle, int enPassantSquare = -1);
+
+	void Clear();
+
+	void SetPiece(int square, EType type, EColor color);
+	void RemovePiece(int square);
+	void MovePiece(int from, int to);
+
+	bool IsEmpty(int square) const;
+	EColor GetColor(int square) const;
+	EType GetType(int square) const;
+
+	Bitboard GetPieces(EColor color, EType type) const;
+	Bitboard GetOccupancy(EColor color) const;
+	Bitboard GetOccupancy() const;
+
+	EColor GetTurn() const;
+	void SetTurn(EColor turn);
+
+	bool IsCastlingAvailable(EColor color, ESide side) const;
+	const CastleValues& GetCastle() const;
+	void SetCastle(const CastleValues& castle);
+	void DisableCastle(EColor color, ESide side);
+
+	int GetEnPassantSquare() const;
+	bool IsEnPassant(int from, int to) const;
+
+	int GetKingSquare(EColor color) const;
+
+	std::uint64_t GetKey() const;
+	std::uint64_t ComputeKey() const;
+
+	int Evaluate() const;
+	int ComputeEvaluation() const;
+
+	// Evaluates with the network of the accumulator instead of the tables, nullptr goes back to the tables.
+	// The accumulator is filled with the current pieces and follows every later change. Copies of the
+	// position share it, so a copy must be given its own before it changes
+	void SetAccumulator(Nnue::Accumulator* accumulator);
+
+	Bitboard GetAttackersTo(int square, EColor attackerColor, Bitboard occupancy) const;
+	bool IsAttacked(int square, EColor attackerColor) const;
+	bool IsInCheck(EColor color) const;
+	void ComputeAttackMap(AttackMap& attackMap) const;
+
+	Bitboard GetLegalTargets(int from) const;
+	bool HasLegalMove() const;
+	void GenerateLegalMoves(FixedMoveList& moves, EMoveKind kind = EMoveKind::All) const;
+	void GenerateLegalMoves(int from, FixedMoveList& moves) const;
+	bool IsLegal(Move move) const;
+
+	// Material the player to move wins with the move once every capture on its final square is played out,
+	// each side taking with its least valuable piece and stopping when that loses. Pins are ignored
+	int StaticExchange(Move move) const;
+
+	UndoInfo MakeMove(int from, int to, EType promotion = EType::Pawn);
+	UndoInfo MakeMove(Move move);
+	void UnmakeMove(const UndoInfo& undo);
+
+private:
+	// Computed once per position and shared by the legal targets of every piece //
+	struct CheckInfo
+	{
+		int kingSquare;
+		Bitboard checkers;
+		Bitboard pinned;
+		Bitboard evasionMask;	// Squares where a move other than the king's ends the check, all squares when not in check
+	};
+
+	CheckInfo GetCheckInfo() const;
+	Bitboard GetLegalTargets(int from, const CheckInfo& info) const;
+	Bitboard GetKingTargets(int kingSquare) const;
+	Bitboard GetPseudoLegalTargets(int from) const;
+	Bitboard GetCastleTargets(int kingSquare) const;
+	void AddMoves(int from, Bitboard targets, FixedMoveList& moves) const;
+	bool LeavesKingSafe(int from, int to) const;
+	EMoveFlag GetMoveFlag(int from, int to) const;
+	void UpdateCastleRights(int square);
+	void SetEnPassantSquare(int square);
+
+	static EColor Opponent(EColor color);
+
+private:
+	std::array<std::array<Bitboard, 6>, 2> m_pieces;	// indexed by EColor and EType
+	std::array<Bitboard, 2> m_occupancy;
+	Bitboard m_allOccupancy;
+
+	EColor m_turn;
+	CastleValues m_castle;
+	int m_enPassantSquare;	// Square passed over by the last double pawn push, -1 if it can not be captured
+
+	std::uint64_t m_key;	// Zobrist key, updated by every change of the members above
+
+	// Sums of the Evaluation tables over all pieces, updated by SetPiece and RemovePiece //
+	int m_middlegameScore;
+	int m_endgameScore;
+	int m_phase;
+
+	Nnue::Accumulator* m_accumulator;	// Not owned, nullptr when evaluating with the tables
+};
@@ -0,0 +1,171 @@
+#include "ChessEngine.h"
+#include "ChessGame.h"
+#include "ChessException.h"
+#include "Searcher.h"
+
+#include <memory>
+
+// ---		Local Static Functions													--- //
+
+static ChessMove ToChessMove(Move move)
+{
+	return { move.GetFromPosition(), move.GetToPosition(), move.GetFlag(), move.GetPromotion() };
+}
+
+// Stops the helper searchers and waits for them, also when the main search throws,
+// so they never run on searchers that are already destroyed //
+class HelperStopGuard
+{
+public:
+	HelperStopGuard(std::atomic_bool& stop, ThreadPool& helpers)
+		: m_stop(stop)
+		, m_helpers(helpers)
+	{
+	}
+
+	~HelperStopGuard()
+	{
+		m_stop = true;
+		m_helpers.Wait();
+	}
+
+	HelperStopGuard(const HelperStopGuard&) = delete;
+	HelperStopGuard& operator=(const HelperStopGuard&) = delete;
+
+private:
+	std::atomic_bool& m_stop;
+	ThreadPool& m_helpers;
+};
+
+// ------------------------------------------------------------------------------------ //
+
+IChessEnginePtr IChessEngine::CreateEngine()
+{
+	return std::make_shared<ChessEngine>();
+}
+
+SearchLimits IChessEngine::GetClockLimits(const IChessGameTimedMode& clock, EColor color)
+{
+	SearchLimits limits;
+	limits.remainingTime = clock.GetRemainingTime(color);
+	limits.increment = clock.GetIncrement();
+	return limits;
+}
+
+ChessEngine::ChessEngine()
+	: m_stop(false)
+{
+	SetThreadCount(1);
+}
+
+SearchResult ChessEngine::Search(const IChessGameStatus& game, const SearchLimits& limits)
+{
+	// The engine needs the en passant square and the keys of the previous positions, which only ChessGame keeps //
+	const ChessGame* chessGame = dynamic_cast<const ChessGame*>(&game);
+	if (!chessGame)
+	{
+		throw ChessException("The engine can only search games created by ChessLib");
+	}
+
+	const BitboardPosition& position = chessGame->GetPosition();
+	if (!position.HasLegalMove())
+	{
+		throw InvalidStateException("There is no move to search");
+	}
+
+	m_stop = false;
+	m_table.NewSearch();
+
+	std::vector<std::uint64_t> previousKeys = chessGame->GetKeysSinceLastIrreversibleMove();
+
+	// Each searcher holds a whole principal variation table, too big for the stack of every caller //
+	std::vector<std::unique_ptr<Searcher>> searchers;
+	for (int i = 0; i < GetThreadCount(); i++)
+	{
+		Searcher::AgeHistory(*m_histories[i]);
+		searchers.push_back(std::make_unique<Searcher>(position, previousKeys, limits, m_stop, m_table, *m_histories[i], m_network.get(), i));
+	}
+
+	// The result is the main searcher's, the helpers only stop once it is known //
+	{
+		HelperStopGuard helperStop(m_stop, m_helpers);
+
+		m_helpers.Start([&searchers](int index) { searchers[index + 1]->Run(); });
+		searchers[0]->Run();
+	}
+
+	const Searcher& searcher = *searchers[0];
+
+	SearchResult result;
+	result.bestMove = ToChessMove(searcher.GetBestMove());
+	result.score = searcher.GetScore();
+	result.depth = searcher.GetDepth();
+	result.nodes = 0;
+
+	for (const auto& threadSearcher : searchers)
+	{
+		result.nodes += threadSearcher->GetNodes();
+	}
+
+	for (Move move : searcher.GetPrincipalVariation())
+	{
+		result.principalVariation.push_back(ToChessMove(move));
+	}
+	return result;
+}
+
+void ChessEngine::Stop()
+{
+	m_stop = true;
+}
+
+void ChessEngine::SetHashSize(int megabytes)
+{
+	m_table.Resize(megabytes > 0 ? megabytes : 1);
+}
+
+void ChessEngine::ClearHash()
+{
+	m_table.Clear();
+}
+
+int ChessEngine::GetHashfull() const
+{
+	return m_table.GetHashfull();
+}
+
+bool ChessEngine::LoadNetwork(const std::string& fileName)
+{
+	std::unique_ptr<Nnue::Network> network = Nnue::Network::Load(fileName);
+	if (!network)
+		return false;
+
+	m_network = std::move(network);
+	return true;
+}
+
+void ChessEngine::UnloadNetwork()
+{
+	m_network.reset();
+}
+
+void ChessEngine::SetThreadCount(int count)
+{
+	count = count > 0 ? count : 1;
+
+	m_helpers.Resize(count - 1);
+
+	while ((int)m_histories.size() < count)
+	{
+		m_histories.push_back(std::make_unique<HistoryTable>());
+		for (auto& colorHistory : *m_histories.back())
+			for (auto& fromHistory : colorHistory)
+				fromHistory.fill(0);
+	}
+	m_histories.resize(count);
+}
+
+int ChessEngine::GetThreadCount() const
+{
+	return m_helpers.GetSize() + 1;
+}
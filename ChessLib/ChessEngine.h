@@ -0,0 +1,39 @@
+#pragma once
+
+#include "IChessEngine.h"
+#include "TranspositionTable.h"
+#include "Searcher.h"
+#include "ThreadPool.h"
+#include "Nnue.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class ChessEngine : public IChessEngine
+{
+public:
+	ChessEngine();
+
+	SearchResult Search(const IChessGameStatus& game, const SearchLimits& limits) override;
+	void Stop() override;
+
+	void SetHashSize(int megabytes) override;
+	void ClearHash() override;
+	int GetHashfull() const override;
+
+	void SetThreadCount(int count) override;
+	int GetThreadCount() const override;
+
+	bool LoadNetwork(const std::string& fileName) override;
+	void UnloadNetwork() override;
+
+private:
+	std::atomic_bool m_stop;
+	TranspositionTable m_table;
+
+	ThreadPool m_helpers;	// Runs every searcher but the main one, which runs on the calling thread
+	std::vector<std::unique_ptr<HistoryTable>> m_histories;	// One per searcher
+
+	std::unique_ptr<Nnue::Network> m_network;	// nullptr when searching with the evaluation tables
+};
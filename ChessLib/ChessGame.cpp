@@ -2,7 +2,9 @@
 #include "Piece.h"
 #include "ChessException.h"
 #include "PGNReader.h"
+#include "AlgebraicNotation.h"
 
+#include <algorithm>
 #include <cctype>
 
 // ---		Local Static Functions													--- //
@@ -18,28 +20,6 @@ static const CharBoard DEFAULT_CHAR_BOARD = {
 	'r', 'h', 'b', 'q', 'k', 'b', 'h', 'r'
 };
 
-static const std::string TABLE_COLUMNS("abcdefgh");
-static const std::string TABLE_ROWS("87654321");
-
-static EType GetType(char c)
-{
-	// white pieces: p r h b q k
-	// black pieces: P R H B Q K
-	// empty tile: ' '
-
-	static const EType types[] = { EType::Pawn,EType::Rook, EType::Horse, EType::Bishop, EType::Queen, EType::King };
-
-	std::string str = "prhbqk";
-	int pos = str.find_first_of(tolower(c));
-
-	return types[pos];
-}
-
-static EColor GetColor(char c)
-{
-	return islower(c) ? EColor::White : EColor::Black;
-}
-
 // ------------------------------------------------------------------------------------ //
 
 // --- IChessGame Virtual Implementations											--- //
@@ -100,7 +80,7 @@ const IChessGameStatus* ChessGame::GetStatus() const
 IPiecePtr ChessGame::GetIPiecePtr(Position pos) const
 {
 	if(IsInMatrix(pos))
-		return m_board[pos.row][pos.col];
+		return Piece::ToIPiecePtr(m_board[pos.row][pos.col]);
 
 	throw InvalidBoardPositionException("Position out of range");
 }
@@ -108,50 +88,81 @@ IPiecePtr ChessGame::GetIPiecePtr(Position pos) const
 PositionList ChessGame::GetPossibleMoves(Position currentPos) const
 {
 	PositionList possibleMoves;
-	PiecePtr currentPiece = m_board[currentPos.row][currentPos.col];
 
-	if (currentPiece)
+	Bitboard targets = m_position.GetLegalTargets(ToSquare(currentPos));
+	while (targets)
 	{
-		if (currentPiece->GetColor() == m_turn)
-		{
-			possibleMoves = currentPiece->GetPattern(currentPos,
-				std::bind(&ChessGame::GetPiece, this, std::placeholders::_1, m_board));
-		}
+		possibleMoves.push_back(ToPosition(PopLsb(targets)));
 	}
 
-	for (int i = 0; i < possibleMoves.size(); i++)
-	{
-		Position pos = possibleMoves[i];  // The pos variable is for iterating the possible moves //
-
-		PiecePtr currentPieceCopy = m_board[currentPos.row][currentPos.col];
-		PiecePtr finalPieceCopy = m_board[pos.row][pos.col];
+	return possibleMoves;
+}
 
-		// Create alternative board  My code //
+void ChessGame::GetPossibleMoves(Position currentPos, FixedMoveList& moves) const
+{
+	moves.clear();
+	m_position.GenerateLegalMoves(ToSquare(currentPos), moves);
+}
 
-		ArrayBoard boardAfterMove = m_board;
-		Position kingPosition = m_kingPositions[(int)m_turn];
+const ChessMoveList& ChessGame::GetAllPossibleMoves() const
+{
+	std::lock_guard<std::mutex> lock(m_possibleMovesMutex);
 
-		boardAfterMove[pos.row][pos.col] = boardAfterMove[currentPos.row][currentPos.col];
-		boardAfterMove[currentPos.row][currentPos.col].reset();
+	if (!m_possibleMovesGenerated || m_possibleMovesKey != m_position.GetKey())
+	{
+		FixedMoveList moves;
+		m_position.GenerateLegalMoves(moves);
 
-		if (boardAfterMove[pos.row][pos.col]->GetType() == EType::King)
+		m_possibleMoves.clear();
+		for (const auto& move : moves)
 		{
-			kingPosition = pos;
+			m_possibleMoves.push_back(ToChessMove(move));
 		}
 
-		if (CanBeCaptured(boardAfterMove, kingPosition))
-		{
-			possibleMoves.erase(std::find(possibleMoves.begin(), possibleMoves.end(), pos));
-			i--;
-		}
+		m_possibleMovesKey = m_position.GetKey();
+		m_possibleMovesGenerated = true;
 	}
+	return m_possibleMoves;
+}
+
+bool ChessGame::IsAttacked(Position pos, EColor attackerColor) const
+{
+	if (!IsInMatrix(pos))
+		throw InvalidBoardPositionException("Position out of range");
+
+	return (GetAttackMap().attacked[(int)attackerColor] & SquareBB(ToSquare(pos))) != 0;
+}
+
+int ChessGame::StaticExchange(Position initialPos, Position finalPos) const
+{
+	if (!IsInMatrix(initialPos) || !IsInMatrix(finalPos))
+		throw InvalidBoardPositionException("Position out of range");
+
+	// Upgrades are listed queen first //
+	FixedMoveList moves;
+	m_position.GenerateLegalMoves(ToSquare(initialPos), moves);
 
-	if (currentPiece && currentPiece->GetType() == EType::King)
+	for (const auto& move : moves)
 	{
-		AddCastle(currentPos, possibleMoves);
+		if (move.GetTo() == ToSquare(finalPos))
+			return m_position.StaticExchange(move);
 	}
+	throw NotInPossibleMovesException("Your move is not possible");
+}
 
-	return possibleMoves;
+PositionList ChessGame::GetAttackers(Position pos, EColor attackerColor) const
+{
+	if (!IsInMatrix(pos))
+		throw InvalidBoardPositionException("Position out of range");
+
+	PositionList attackers;
+
+	Bitboard pieces = GetAttackMap().attackers[ToSquare(pos)] & m_position.GetOccupancy(attackerColor);
+	while (pieces)
+	{
+		attackers.push_back(ToPosition(PopLsb(pieces)));
+	}
+	return attackers;
 }
 
 IPieceList ChessGame::GetCapturedPieces(EColor color) const
@@ -215,7 +226,17 @@ bool ChessGame::IsCheckState() const
 
 bool ChessGame::IsCastlingAvailable(EColor color, ESide side) const
 {
-	return m_castle[(int)color][(int)side];
+	return m_position.IsCastlingAvailable(color, side);
+}
+
+std::uint64_t ChessGame::GetPositionKey() const
+{
+	return m_position.GetKey();
+}
+
+int ChessGame::Evaluate() const
+{
+	return m_position.Evaluate();
 }
 
 // ------------------------------------------------------------------------------------ //
@@ -228,7 +249,6 @@ void ChessGame::ResetGame()
 
 	m_whitePiecesCaptured.clear();
 	m_blackPiecesCaptured.clear();
-	m_boardConfigFrequency.clear();
 
 	InitializeChessGame();
 
@@ -241,7 +261,6 @@ void ChessGame::RestoreGame(const CharBoard& inputConfig, EColor turn /*= EColor
 
 	m_whitePiecesCaptured.clear();
 	m_blackPiecesCaptured.clear();
-	m_boardConfigFrequency.clear();
 
 	InitializeChessGame(inputConfig, turn, castle);
 
@@ -264,173 +283,132 @@ void ChessGame::MakeMove(Position initialPos, Position finalPos, bool EnableNoti
 		throw OccupiedByOwnPieceException("The final square is occupied by own piece");
 	}
 
-	PositionList possibleMoves = GetPossibleMoves(initialPos);
-	if (std::find(possibleMoves.begin(), possibleMoves.end(), finalPos) == possibleMoves.end())
+	FixedMoveList legalMoves;
+	m_position.GenerateLegalMoves(legalMoves);
+
+	auto legalMove = std::find_if(legalMoves.begin(), legalMoves.end(), [initialPos, finalPos](Move move)
+		{
+			return move.GetFromPosition() == initialPos && move.GetToPosition() == finalPos;
+		});
+	if (legalMove == legalMoves.end())
 	{
 		throw NotInPossibleMovesException("Your move is not possible");
 	}
 
-	UpdateState(EGameState::MovingPiece);
+	// With notifications the upgrade is chosen later, so the notation can not name it //
+	Move move = *legalMove;
+	if (move.GetPromotion() != EType::Pawn)
+	{
+		move = Move(move.GetFrom(), move.GetTo(), move.GetFlag(), EnableNotification ? EType::Pawn : upgradeType);
+	}
 
-	// For PGN Begin // 
+	PlayMove(move, legalMoves, EnableNotification);
+}
 
-	std::string move;
+void ChessGame::PlayMove(Move move, const FixedMoveList& legalMoves, bool EnableNotification)
+{
+	Position initialPos = move.GetFromPosition();
+	Position finalPos = move.GetToPosition();
 
-	if (m_turn == EColor::White)
-		move = std::to_string(m_turnCount + 1) + ". ";
+	MoveRecord record;
+	record.movedPiece = m_board[initialPos.row][initialPos.col];
+	record.state = m_state;
+	record.turnCount = m_turnCount;
+	record.lastIrreversibleMove = m_lastIrreversibleMove;
 
-	char pieceLetter = std::toupper(m_board[initialPos.row][initialPos.col]->ToLetter());
-	if (pieceLetter == 'H')
-	{
-		pieceLetter = 'N';
-	}
-
-	if (pieceLetter != 'P')
-	{
-		move += pieceLetter;
-	}
+	UpdateState(EGameState::MovingPiece);
 
-	Position pos = GetPiecePositionWithSameTypeThatCanMoveToFinalPosition(initialPos, finalPos,
-		m_board[initialPos.row][initialPos.col]->GetType());
+	// For PGN // 
+	std::string notation;
+	if (m_turn == EColor::White)
+		notation = std::to_string(m_turnCount + 1) + ". ";
+	notation += AlgebraicNotation::MoveToString(move, m_position, legalMoves);
 
-	if (pos.col != -1 && pieceLetter != 'P')
-	{
-		move += TABLE_COLUMNS[initialPos.col];
-	}
-	if (pos.row != -1 && pieceLetter != 'P')
+	// At en passant the captured pawn is next to the initial position, not on the final one //
+	Position capturedPos = finalPos;
+	if (move.GetFlag() == EMoveFlag::EnPassant)
 	{
-		move = move + std::to_string(8 - initialPos.row);
+		capturedPos = Position(initialPos.row, finalPos.col);
 	}
 
-	// For PGN End // 
+	record.capturedPiece = m_board[capturedPos.row][capturedPos.col];
+	record.capturedPos = capturedPos;
 
-	if (m_board[finalPos.row][finalPos.col])
+	if (m_board[capturedPos.row][capturedPos.col])
 	{
-		if (pieceLetter == 'P')
-		{
-			move += TABLE_COLUMNS[initialPos.col];
-		}
-		move += "x";	// For PGN // 
 		if (m_turn == EColor::White)
 		{
-			m_blackPiecesCaptured.push_back(m_board[finalPos.row][finalPos.col]);
+			m_blackPiecesCaptured.push_back(Piece::ToIPiecePtr(m_board[capturedPos.row][capturedPos.col]));
 		}
 		else
 		{
-			m_whitePiecesCaptured.push_back(m_board[finalPos.row][finalPos.col]);
+			m_whitePiecesCaptured.push_back(Piece::ToIPiecePtr(m_board[capturedPos.row][capturedPos.col]));
 		}
+		m_board[capturedPos.row][capturedPos.col] = nullptr;
 	}
 
-	m_board[finalPos.row][finalPos.col] = m_board[initialPos.row][initialPos.col];
-	m_board[initialPos.row][initialPos.col].reset();
+	// The bitboard position also updates the castle values and the en passant square //
+	record.undo = m_position.MakeMove(ToSquare(initialPos), ToSquare(finalPos), move.GetPromotion());
+	MovePieceOnBoard(initialPos, finalPos);
 
-	if (m_board[finalPos.row][finalPos.col]->GetType() == EType::Rook)
+	if (move.GetPromotion() != EType::Pawn)
 	{
-		// Make Castle Inaccessible if Rook moved
-		m_castle[(int)m_turn][initialPos.col % 2] = false;
+		m_board[finalPos.row][finalPos.col] = Piece::Produce(move.GetPromotion(), record.movedPiece->GetColor());
 	}
-	else if (m_board[finalPos.row][finalPos.col]->GetType() == EType::King)
+
+	if (move.GetFlag() == EMoveFlag::Castle)
 	{
-		m_kingPositions[(int)m_turn] = finalPos;
-		// Make Castle Inaccessible if King moved
-		m_castle[(int)m_turn][0] = false;
-		m_castle[(int)m_turn][1] = false;
 		if (initialPos.col - finalPos.col == 2)
 		{
-			move.resize(move.length() - 1);
-			move += "0-0-0";  // For PGN // 
-			m_board[finalPos.row][finalPos.col + 1] = m_board[finalPos.row][0];
-			m_board[finalPos.row][0].reset();
+			MovePieceOnBoard(Position(finalPos.row, 0), Position(finalPos.row, finalPos.col + 1));
 			if (EnableNotification)
 				NotifyMoveMade(Position(finalPos.row, 0), Position(finalPos.row, finalPos.col + 1));
 		}
-		else if (initialPos.col - finalPos.col == -2)
+		else
 		{
-			move.resize(move.length() - 1);
-			move += "0-0";	// For PGN // 
-			m_board[finalPos.row][finalPos.col - 1] = m_board[finalPos.row][7];
-			m_board[finalPos.row][7].reset();
+			MovePieceOnBoard(Position(finalPos.row, 7), Position(finalPos.row, finalPos.col - 1));
 			if (EnableNotification)
 				NotifyMoveMade(Position(finalPos.row, 7), Position(finalPos.row, finalPos.col - 1));
 		}
 	}
 
-	// For PGN  Begin // 
-
-	if (move.length() == 0 || move[move.length() - 1] != '0')
-	{
-		BoardPosition boardPos = ConvertToBoardPosition(finalPos);
-		move += boardPos.second;
-		move += boardPos.first;
-	}
-
-	// For PGN  End // 
-
 	//StopPlayerTimer(); // Stop the timer for the current player
-	SwitchTurn();      // Switch to the next player's turn
+	record.increment = SwitchTurn();      // Switch to the next player's turn
 	//StartPlayerTimer(); // Start the timer for the next player
 
 	if (EnableNotification)
 		NotifyMoveMade(initialPos, finalPos);
 
-	if (m_board[finalPos.row][finalPos.col]->GetType() == EType::Pawn)
-	{
-		if (m_board[finalPos.row][finalPos.col]->GetColor() == EColor::White && finalPos.row == 0)
-		{
-			if (EnableNotification)
-			{
-				UpdateState(EGameState::UpgradePawn);
-				NotifyPawnUpgrade(finalPos);
-			}
-			else
-				UpgradePawn(upgradeType);
+	SaveConfiguration(record.capturedPiece || record.movedPiece->GetType() == EType::Pawn);
 
-			// For PGN // 
-			pieceLetter = std::toupper(m_board[finalPos.row][finalPos.col]->ToLetter());
-			if (pieceLetter == 'H')
-			{
-				pieceLetter = 'N';
-			}
+	// Saved first, so the upgrade a listener chooses replaces the pawn in the saved position //
+	if (EnableNotification && m_board[finalPos.row][finalPos.col]->GetType() == EType::Pawn && (finalPos.row == 0 || finalPos.row == 7))
+	{
+		UpdateState(EGameState::UpgradePawn);
+		NotifyPawnUpgrade(finalPos);
 
-			move += "=";
-			move += pieceLetter;
-		}
-		if (m_board[finalPos.row][finalPos.col]->GetColor() == EColor::Black && finalPos.row == 7)
+		// The notation could not name the upgrade, unless a listener has chosen it already //
+		char pieceLetter = std::toupper(m_board[finalPos.row][finalPos.col]->ToLetter());
+		if (pieceLetter != 'P')
 		{
-			if (EnableNotification)
-			{
-				UpdateState(EGameState::UpgradePawn);
-				NotifyPawnUpgrade(finalPos);
-			}
-			else
-				UpgradePawn(upgradeType);
-
-			// For PGN //
-			pieceLetter = std::toupper(m_board[finalPos.row][finalPos.col]->ToLetter());
-			if (pieceLetter == 'H')
-			{
-				pieceLetter = 'N';
-			}
-			move += "=";
-			move += pieceLetter;
+			notation += "=";
+			notation += pieceLetter == 'H' ? 'N' : pieceLetter;
 		}
 	}
 
-	SaveConfiguration();
-
 	UpdateState(EGameState::MovingPiece);
 
 	if (CheckThreeFoldRepetition())
 	{
-		move += " 1/2-1/2";		// For PGN //
+		notation += " 1/2-1/2";		// For PGN //
 
 		UpdateState(EGameState::Draw);
 		Notify(ENotification::GameOver);
 	}
 
-	if (CanBeCaptured(m_board, m_kingPositions[(int)m_turn]) == true)
+	if (m_position.IsInCheck(m_turn))
 	{
-		move += "+";		// For PGN //
+		notation += "+";		// For PGN //
 
 		UpdateState(EGameState::CheckState);
 		Notify(ENotification::Check);
@@ -438,25 +416,73 @@ void ChessGame::MakeMove(Position initialPos, Position finalPos, bool EnableNoti
 
 	if (CheckCheckMate())
 	{
-		move[move.length() - 1] = '#';	// For PGN //
+		notation[notation.length() - 1] = '#';	// For PGN //
 
 		UpdateState(m_turn == EColor::White ? EGameState::WonByBlackPlayer : EGameState::WonByWhitePlayer);
 		Notify(ENotification::GameOver);
 	}
 	else if (CheckStaleMate())
 	{
-		move += "1/2-1/2";	// For PGN // 
+		notation += " 1/2-1/2";	// For PGN // 
 
 		UpdateState(EGameState::Draw);
 		Notify(ENotification::GameOver);
 	}
 
-	m_PGNFormat.AddMove(move);
+	m_PGNFormat.AddMove(notation);
 	if (m_turn == EColor::Black)
 	{
 		m_turnCount++;
 	}
-	NotifyHistoryUpdate(move);
+	m_history.push_back(record);
+	NotifyHistoryUpdate(notation);
+}
+
+void ChessGame::UndoMove()
+{
+	if (m_history.empty())
+	{
+		throw InvalidStateException("There is no move to undo");
+	}
+
+	const MoveRecord& record = m_history.back();
+
+	Position initialPos = ToPosition(record.undo.move.GetFrom());
+	Position finalPos = ToPosition(record.undo.move.GetTo());
+
+	m_position.UnmakeMove(record.undo);
+
+	m_board[initialPos.row][initialPos.col] = record.movedPiece;
+	m_board[finalPos.row][finalPos.col] = nullptr;
+
+	if (record.movedPiece->GetType() == EType::King)
+	{
+		if (initialPos.col - finalPos.col == 2)
+			MovePieceOnBoard(Position(finalPos.row, finalPos.col + 1), Position(finalPos.row, 0));
+		else if (initialPos.col - finalPos.col == -2)
+			MovePieceOnBoard(Position(finalPos.row, finalPos.col - 1), Position(finalPos.row, 7));
+	}
+
+	if (record.capturedPiece)
+	{
+		m_board[record.capturedPos.row][record.capturedPos.col] = record.capturedPiece;
+		if (record.movedPiece->GetColor() == EColor::White)
+			m_blackPiecesCaptured.pop_back();
+		else
+			m_whitePiecesCaptured.pop_back();
+	}
+
+	m_boardConfigurations.pop_back();
+	m_positionKeys.pop_back();
+	m_lastIrreversibleMove = record.lastIrreversibleMove;
+
+	m_PGNFormat.RemoveLastMove();
+
+	UndoTurn(record.increment);
+	m_turnCount = record.turnCount;
+	m_state = record.state;
+
+	m_history.pop_back();
 }
 
 void ChessGame::UpgradePawn(EType upgradeType)
@@ -466,6 +492,9 @@ void ChessGame::UpgradePawn(EType upgradeType)
 		if (m_board[0][i] && m_board[0][i]->GetType() == EType::Pawn)
 		{
 			m_board[0][i] = Piece::Produce(upgradeType, EColor::White);
+			m_position.RemovePiece(i);
+			m_position.SetPiece(i, upgradeType, EColor::White);
+			UpdateLastConfiguration(Position(0, i));
 			return;
 		}
 	}
@@ -474,6 +503,9 @@ void ChessGame::UpgradePawn(EType upgradeType)
 		if (m_board[7][i] && m_board[7][i]->GetType() == EType::Pawn)
 		{
 			m_board[7][i] = Piece::Produce(upgradeType, EColor::Black);
+			m_position.RemovePiece(56 + i);
+			m_position.SetPiece(56 + i, upgradeType, EColor::Black);
+			UpdateLastConfiguration(Position(7, i));
 			return;
 		}
 	}
@@ -512,33 +544,11 @@ bool ChessGame::LoadFromFile(EFormat format, const std::string& fileName)
 	ChessData gameData = GetData();
 	ResetGame();
 
-	auto moves = reader.GetMoves();
-	for (auto& move : moves)
+	const StringMoveList& moves = reader.GetMoves();
+	if (PlayMoves(moves) != (int)moves.size())
 	{
-		EType upgradeType = EType::Pawn;
-
-		int evolvePos = move.find('=');
-		if (evolvePos != -1)
-		{
-			upgradeType = Piece::GetTypeFromLetter(move[evolvePos + 1]);
-			move.erase(evolvePos, 2);
-		}
-
-		Position initialPosition;
-		Position finalPosition;
-
-		ConvertMoveToPositions(move, initialPosition, finalPosition);
-
-		try
-		{
-			MakeMove(initialPosition, finalPosition, false, upgradeType);
-		}
-		catch (const ChessException& e)
-		{
-			//ResetGame();
-			SetData(gameData);
-			return false;
-		}
+		SetData(gameData);
+		return false;
 	}
 	return true;
 }
@@ -581,6 +591,16 @@ void ChessGame::SetRefreshRate(int milliseconds)
 	throw std::logic_error("The method or operation is not implemented.");
 }
 
+void ChessGame::SetIncrement(int milliseconds)
+{
+	m_timer.SetIncrement(std::chrono::milliseconds(milliseconds));
+}
+
+int ChessGame::GetIncrement() const
+{
+	return m_timer.GetIncrement();
+}
+
 int ChessGame::GetRemainingTime(EColor color) const
 {
 	return m_timer.GetRemainingTime(color);
@@ -596,14 +616,15 @@ bool ChessGame::IsPaused() const
 // --- Constructors																	--- //
 
 ChessGame::ChessGame()
+	: m_board()
 {
 	InitializeChessGame();
 }
 
 ChessGame::ChessGame(const CharBoard& inputConfig, EColor turn, CastleValues castle)
-	: m_turn(turn)
+	: m_board()
+	, m_turn(turn)
 	, m_state(EGameState::MovingPiece)
-	, m_castle(castle)
 {
 	InitializeChessGame(inputConfig, turn, castle);
 }
@@ -615,19 +636,16 @@ ChessGame::ChessGame(const CharBoard& inputConfig, EColor turn, CastleValues cas
 void ChessGame::InitializeChessGame()
 {
 	m_boardConfigurations.clear();
-	m_boardConfigFrequency.clear();
+	m_positionKeys.clear();
+	m_history.clear();
 	m_whitePiecesCaptured.clear();
 	m_blackPiecesCaptured.clear();
 	m_turnCount = 0; 
 
 	m_turn = EColor::White;
-	m_kingPositions = { Position(7 ,4), Position(0, 4) };
+	m_position = BitboardPosition(DEFAULT_CHAR_BOARD, EColor::White, { true, true, true, true });
 	UpdateState(EGameState::MovingPiece);
 
-	for (int i = 0; i < 2; i++)
-		for (int j = 0; j < 2; j++)
-			m_castle[i][j] = true;
-
 	for (int j = 0; j < 8; j++)
 	{
 		m_board[6][j] = Piece::Produce(EType::Pawn, EColor::White);
@@ -642,9 +660,9 @@ void ChessGame::InitializeChessGame()
 		m_board[7][i] = Piece::Produce(TYPES[i], EColor::White);
 	}
 
-	m_boardConfigFrequency[DEFAULT_CHAR_BOARD] = 1;
-
 	m_boardConfigurations.push_back(DEFAULT_CHAR_BOARD);
+	m_positionKeys.push_back(m_position.GetKey());
+	m_lastIrreversibleMove = 0;
 }
 
 void ChessGame::InitializeChessGame(const CharBoard& inputConfig, EColor turn, CastleValues castle)
@@ -652,190 +670,65 @@ void ChessGame::InitializeChessGame(const CharBoard& inputConfig, EColor turn, C
 	m_turn = turn;
 	UpdateState(EGameState::MovingPiece);
 	m_boardConfigurations.clear();
-	m_boardConfigFrequency.clear();
+	m_positionKeys.clear();
+	m_history.clear();
 
-	for (int i = 0; i < 2; i++)
-		for (int j = 0; j < 2; j++)
-			m_castle[i][j] = castle[i][j];
-
-	m_kingPositions.resize(2);
+	m_position = BitboardPosition(inputConfig, turn, castle);
 
 	for (int i = 0; i < 8; i++)
 	{
 		for (int j = 0; j < 8; j++)
 		{
-			if (inputConfig[i][j] == ' ')
+			int square = i * 8 + j;
+			if (m_position.IsEmpty(square))
 			{
 				continue;
 			}
 
-			EType type = GetType(inputConfig[i][j]);
-			EColor color = GetColor(inputConfig[i][j]);
-
-			m_board[i][j] = Piece::Produce(type, color);
-			if (type == EType::King)
-			{
-				m_kingPositions[(int)color] = Position(i, j);
-			}
+			m_board[i][j] = Piece::Produce(m_position.GetType(square), m_position.GetColor(square));
 		}
 	}
-	if (CanBeCaptured(m_board, m_kingPositions[(int)turn]))
+	if (m_position.IsInCheck(turn))
 	{
 		UpdateState(EGameState::CheckState);
 	}
 
-	m_boardConfigFrequency[inputConfig] = 1;
 	m_boardConfigurations.push_back(inputConfig);
+	m_positionKeys.push_back(m_position.GetKey());
+	m_lastIrreversibleMove = 0;
 }
 
 void ChessGame::ResetBoard()
 {
-	for (int i = 0; i < 8; i++)
-	{
-		for (int j = 0; j < 8; j++)
-		{
-			m_board[i][j].reset();
-		}
-	}
-}
+	for (auto& row : m_board)
+		row.fill(nullptr);
 
-PiecePtr ChessGame::GetPiece(Position pos, const ArrayBoard& board) const
-{
-	return board[pos.row][pos.col];
+	m_position.Clear();
 }
 
-PieceList ChessGame::GetCheckPieces(Position& checkPos) const
+void ChessGame::MovePieceOnBoard(Position initialPos, Position finalPos)
 {
-	PieceList checkPieces;
-	for (int i = 0; i < 8; i++)
-	{
-		for (int j = 0; j < 8; j++)
-		{
-			if (m_board[i][j] && m_board[i][j]->GetColor() != m_turn)
-			{
-				PositionList enemyPiecePositions = m_board[i][j]->GetPattern(Position(i, j),
-					std::bind(&ChessGame::GetPiece, this, std::placeholders::_1, m_board));
-
-				for (auto pos : enemyPiecePositions)
-				{
-					if (pos == m_kingPositions[(int)m_turn])
-					{
-						if (checkPieces.empty())
-						{
-							checkPieces.push_back(m_board[i][j]);
-							checkPos = Position(i, j);
-						}
-						else
-						{
-							checkPieces.push_back(m_board[i][j]);
-							break;
-						}
-					}
-				}
-			}
-		}
-	}
-	return checkPieces;
-}
-
-Position ChessGame::GetMovingDirections(const Position& checkPiecePos) const
-{
-	int movingRow;
-	int movingCol;
-
-	Position kingPosition = m_kingPositions[(int)m_turn];
-
-	if (kingPosition.row < checkPiecePos.row)
-	{
-		movingRow = -1;
-	}
-	else if (kingPosition.row > checkPiecePos.row)
-	{
-		movingRow = 1;
-	}
-	else
-	{
-		movingRow = 0;
-	}
-
-	if (kingPosition.col < checkPiecePos.col)
-	{
-		movingCol = -1;
-	}
-	else if (kingPosition.col > checkPiecePos.col)
-	{
-		movingCol = 1;
-	}
-	else
-	{
-		movingCol = 0;
-	}
-
-	return Position(movingRow, movingCol);
+	m_board[finalPos.row][finalPos.col] = m_board[initialPos.row][initialPos.col];
+	m_board[initialPos.row][initialPos.col] = nullptr;
 }
 
-PositionList ChessGame::GetToBlockPositions(const Position& checkPiecePos) const
+ChessMove ChessGame::ToChessMove(Move move)
 {
-	Position kingPosition = m_kingPositions[(int)m_turn];
-	PositionList toBlockPositions;
-	Position movingDirections = GetMovingDirections(checkPiecePos);
-
-	Position iterator_pos(checkPiecePos.row + movingDirections.row, checkPiecePos.col + movingDirections.col);
-
-	while (iterator_pos != kingPosition)
-	{
-		toBlockPositions.push_back(iterator_pos);
-		iterator_pos.row += movingDirections.row;
-		iterator_pos.col += movingDirections.col;
-	}
-
-	return toBlockPositions;
+	return { move.GetFromPosition(), move.GetToPosition(), move.GetFlag(), move.GetPromotion() };
 }
 
-Position ChessGame::GetPiecePositionWithSameTypeThatCanMoveToFinalPosition(Position initialPos, Position finalPos, EType currentPieceType)
+const AttackMap& ChessGame::GetAttackMap() const
 {
-	bool sameRow = false;
-	bool sameCol = false;
-
-	PositionList sameTypePos;
+	std::lock_guard<std::mutex> lock(m_attackMapMutex);
 
-	for (int i = 0; i < 8; i++)
+	if (!m_attackMapGenerated || m_attackMapKey != m_position.GetKey())
 	{
-		for (int j = 0; j < 8; j++)
-		{
-			if (m_board[i][j] && m_board[i][j]->GetColor() == m_turn && m_board[i][j]->GetType() == currentPieceType && Position(i, j) != initialPos)
-			{
-				PositionList possibleMoves = GetPossibleMoves(Position(i, j));
-				if (std::find(possibleMoves.begin(), possibleMoves.end(), finalPos) != possibleMoves.end())
-				{
-					sameTypePos.push_back(Position(i, j));
-				}
-			}
-		}
-	}
+		m_position.ComputeAttackMap(m_attackMap);
 
-	for (auto& pos : sameTypePos)
-	{
-		if (initialPos.row == pos.row)
-			sameRow = true;
-		if (initialPos.col == pos.col)
-			sameCol = true;
+		m_attackMapKey = m_position.GetKey();
+		m_attackMapGenerated = true;
 	}
-
-	if (sameTypePos.empty())
-		return Position(-1, -1);
-
-	if (sameRow && sameCol)
-		return Position(1, 1);
-
-	if (!sameRow && !sameCol)
-		return Position(-1, 1);
-
-	if (sameRow && !sameCol)
-		return Position(-1, 1);
-
-	if (!sameRow && sameCol)
-		return Position(1, -1);
+	return m_attackMap;
 }
 
 ChessData ChessGame::GetData() const
@@ -843,21 +736,19 @@ ChessData ChessGame::GetData() const
 	ChessData data;
 
 	data.board = m_board;
+	data.position = m_position;
 	data.turn = m_turn;
 	data.turnCount = m_turnCount;
 
-
-	data.kingPositions = m_kingPositions;
-
 	data.whitePiecesCaptured = m_whitePiecesCaptured;
 	data.blackPiecesCaptured = m_blackPiecesCaptured;
 
 	data.state = m_state;
 
-	data.castle = m_castle;
-
-	data.boardConfigFrequency = m_boardConfigFrequency;
 	data.boardConfigurations = m_boardConfigurations;
+	data.positionKeys = m_positionKeys;
+	data.lastIrreversibleMove = m_lastIrreversibleMove;
+	data.history = m_history;
 
 	data.PGNFormat = m_PGNFormat;
 
@@ -871,25 +762,34 @@ PiecePtr ChessGame::GetPieceFromBoard(Position pos) const
 	return m_board[pos.row][pos.col];
 }
 
+const BitboardPosition& ChessGame::GetPosition() const
+{
+	return m_position;
+}
+
+std::vector<std::uint64_t> ChessGame::GetKeysSinceLastIrreversibleMove() const
+{
+	return std::vector<std::uint64_t>(m_positionKeys.begin() + m_lastIrreversibleMove, m_positionKeys.end());
+}
+
 void ChessGame::SetData(const ChessData& data)
 {
 	ResetBoard();
 
 	m_board = data.board;
+	m_position = data.position;
 	m_turn = data.turn;
 	m_turnCount = data.turnCount;
 
-	m_kingPositions = data.kingPositions;
-
 	m_whitePiecesCaptured = data.whitePiecesCaptured;
 	m_blackPiecesCaptured = data.blackPiecesCaptured;
 
 	m_state = data.state;
 
-	m_castle = data.castle;
-
-	m_boardConfigFrequency = data.boardConfigFrequency;
 	m_boardConfigurations = data.boardConfigurations;
+	m_positionKeys = data.positionKeys;
+	m_lastIrreversibleMove = data.lastIrreversibleMove;
+	m_history = data.history;
 
 	m_PGNFormat = data.PGNFormat;
 
@@ -898,216 +798,53 @@ void ChessGame::SetData(const ChessData& data)
 
 void ChessGame::SetCastleValues(const CastleValues& Castle)
 {
-	m_castle = Castle;
+	m_position.SetCastle(Castle);
 }
 
-void ChessGame::MakeMoveFromString(std::string& move)
+int ChessGame::PlayMoves(const StringMoveList& moves)
 {
-	EType upgradeType;
-
-	int evolvePos = move.find('=');
-	if (evolvePos != -1)
-	{
-		upgradeType = Piece::GetTypeFromLetter(move[evolvePos + 1]);
-		move.erase(evolvePos, 2);
-	}
-
-	Position initialPosition;
-	Position finalPosition;
-
-	ConvertMoveToPositions(move, initialPosition, finalPosition);
-
-	// Make the actual move //
-
-	if (!IsInMatrix(initialPosition))
-	{
-		throw OutOfBoundsException("Initial position is not a valid position");
-	}
-	if (!IsInMatrix(finalPosition))
-	{
-		throw OutOfBoundsException("Final position is not a valid position");
-	}
-
-	if (m_board[finalPosition.row][finalPosition.col] && m_board[finalPosition.row][finalPosition.col]->GetColor() == m_turn)
-	{
-		throw OccupiedByOwnPieceException("The final square is occupied by own piece");
-	}
-
-	PositionList possibleMoves = GetPossibleMoves(initialPosition);
-	if (std::find(possibleMoves.begin(), possibleMoves.end(), finalPosition) == possibleMoves.end())
-	{
-		throw NotInPossibleMovesException("Your move is not possible");
-	}
-
-	UpdateState(EGameState::MovingPiece);
-
-	// For PGN Begin // 
-
-	move = "";
-
-	if (m_turn == EColor::White)
-		move = std::to_string(m_turnCount + 1) + ". ";
-
-	char pieceLetter = std::toupper(m_board[initialPosition.row][initialPosition.col]->ToLetter());
-	if (pieceLetter == 'H')
-	{
-		pieceLetter = 'N';
-	}
-
-	if (pieceLetter != 'P')
+	int played = 0;
+	for (const auto& move : moves)
 	{
-		move += pieceLetter;
-	}
-
-	Position pos = GetPiecePositionWithSameTypeThatCanMoveToFinalPosition(initialPosition, finalPosition,
-		m_board[initialPosition.row][initialPosition.col]->GetType());
-
-	if (pos.col != -1 && pieceLetter != 'P')
-	{
-		move += TABLE_COLUMNS[initialPosition.col];
-	}
-	if (pos.row != -1 && pieceLetter != 'P')
-	{
-		move = move + std::to_string(8 - initialPosition.row);
-	}
-
-	// For PGN End // 
-
-	if (m_board[finalPosition.row][finalPosition.col])
-	{
-		if (pieceLetter == 'P')
-		{
-			move += TABLE_COLUMNS[initialPosition.col];
-		}
-		move += "x";	// For PGN // 
-		if (m_turn == EColor::White)
-		{
-			m_blackPiecesCaptured.push_back(m_board[finalPosition.row][finalPosition.col]);
-		}
-		else
-		{
-			m_whitePiecesCaptured.push_back(m_board[finalPosition.row][finalPosition.col]);
-		}
-	}
-
-	m_board[finalPosition.row][finalPosition.col] = m_board[initialPosition.row][initialPosition.col];
-	m_board[initialPosition.row][initialPosition.col].reset();
-
-	if (m_board[finalPosition.row][finalPosition.col]->GetType() == EType::Rook)
-	{
-		// Make Castle Inaccessible if Rook moved
-		m_castle[(int)m_turn][initialPosition.col % 2] = false;
-	}
-	else if (m_board[finalPosition.row][finalPosition.col]->GetType() == EType::King)
-	{
-		m_kingPositions[(int)m_turn] = finalPosition;
-		// Make Castle Inaccessible if King moved
-		m_castle[(int)m_turn][0] = false;
-		m_castle[(int)m_turn][1] = false;
-		if (initialPosition.col - finalPosition.col == 2)
-		{
-			move.resize(move.length() - 1);
-			move += "0-0-0";  // For PGN // 
-			m_board[finalPosition.row][finalPosition.col + 1] = m_board[finalPosition.row][0];
-			m_board[finalPosition.row][0].reset();
-			NotifyMoveMade(Position(finalPosition.row, 0), Position(finalPosition.row, finalPosition.col + 1));
-		}
-		else if (initialPosition.col - finalPosition.col == -2)
-		{
-			move.resize(move.length() - 1);
-			move += "0-0";	// For PGN // 
-			m_board[finalPosition.row][finalPosition.col - 1] = m_board[finalPosition.row][7];
-			m_board[finalPosition.row][7].reset();
-			//Notify(ENotification::MoveMade, Position(finalPosition.row, 7), Position(finalPosition.row, finalPosition.col - 1));
-		}
-		//
-	}
-
-	// For PGN  Begin // 
-
-	if (move.length() == 0 || move[move.length() - 1] != '0')// If the move is not Castle //
-	{
-		BoardPosition boardPos = ConvertToBoardPosition(finalPosition);
-		move += boardPos.second;
-		move += boardPos.first;
-	}
-
-	// For PGN  End // 
-
-	SwitchTurn();
-
-	if (m_board[finalPosition.row][finalPosition.col]->GetType() == EType::Pawn)
-	{
-		if (m_board[finalPosition.row][finalPosition.col]->GetColor() == EColor::White && finalPosition.row == 0)
+		try
 		{
-			UpgradePawn(upgradeType);
-
-			// For PGN // 
-			pieceLetter = std::toupper(m_board[finalPosition.row][finalPosition.col]->ToLetter());
-			if (pieceLetter == 'H')
-			{
-				pieceLetter = 'N';
-			}
-			move += "=";
-			move += pieceLetter;
+			MakeMoveFromString(move);
 		}
-		if (m_board[finalPosition.row][finalPosition.col]->GetColor() == EColor::Black && finalPosition.row == 7)
+		catch (const ChessException&)
 		{
-			UpgradePawn(upgradeType);
-
-			// For PGN //
-			pieceLetter = std::toupper(m_board[finalPosition.row][finalPosition.col]->ToLetter());
-			if (pieceLetter == 'H')
-			{
-				pieceLetter = 'N';
-			}
-			move += "=";
-			move += pieceLetter;
+			break;
 		}
+		played++;
 	}
+	return played;
+}
 
-	SaveConfiguration();
-
-	if (CheckThreeFoldRepetition())
-	{
-		move += " 1/2-1/2";		// For PGN //
-
-		UpdateState(EGameState::Draw);
-	}
-
-	if (CanBeCaptured(m_board, m_kingPositions[(int)m_turn]) == true)
-	{
-		move += "+";		// For PGN //
-
-		UpdateState(EGameState::CheckState);
-	}
+void ChessGame::MakeMoveFromString(std::string_view move)
+{
+	FixedMoveList legalMoves;
+	m_position.GenerateLegalMoves(legalMoves);
 
-	if (CheckCheckMate())
+	Move legalMove;
+	if (!AlgebraicNotation::ParseMove(move, m_position, legalMoves, legalMove))
 	{
-		// For PGN //
-		move[move.length() - 1] = '#';
-
-		UpdateState(m_turn == EColor::White ? EGameState::WonByBlackPlayer : EGameState::WonByWhitePlayer);
+		throw NotInPossibleMovesException("Not a legal move: " + std::string(move));
 	}
-	else if (CheckStaleMate())
-	{
-		move += "1/2-1/2";	// For PGN // 
 
-		UpdateState(EGameState::Draw);
-	}
+	PlayMove(legalMove, legalMoves, false);
+}
 
-	m_PGNFormat.AddMove(move);
-	if (m_turn == EColor::Black)
-	{
-		m_turnCount++;
-	}
-	NotifyHistoryUpdate(move);
+std::chrono::milliseconds ChessGame::SwitchTurn()
+{
+	m_turn = (m_turn == EColor::White) ? EColor::Black : EColor::White;
+	m_position.SetTurn(m_turn);
+	return m_timer.SwitchTurn();
 }
 
-void ChessGame::SwitchTurn()
+void ChessGame::UndoTurn(std::chrono::milliseconds increment)
 {
 	m_turn = (m_turn == EColor::White) ? EColor::Black : EColor::White;
-	m_timer.SwitchTurn();
+	m_position.SetTurn(m_turn);
+	m_timer.UndoTurn(increment);
 }
 
 void ChessGame::UpdateState(EGameState state)
@@ -1140,7 +877,7 @@ void ChessGame::UpdateState(EGameState state)
 	}
 }
 
-void ChessGame::SaveConfiguration()
+void ChessGame::SaveConfiguration(bool irreversibleMove)
 {
 	std::array<std::array<char, 8>, 8> currConfig;
 	for (int i = 0; i < 8; i++)
@@ -1157,8 +894,20 @@ void ChessGame::SaveConfiguration()
 			}
 		}
 	}
-	m_boardConfigFrequency[currConfig] ++;
 	m_boardConfigurations.push_back(currConfig);
+	m_positionKeys.push_back(m_position.GetKey());
+
+	// Positions before a capture or a pawn move can not appear again //
+	if (irreversibleMove)
+	{
+		m_lastIrreversibleMove = m_positionKeys.size() - 1;
+	}
+}
+
+void ChessGame::UpdateLastConfiguration(Position changedPos)
+{
+	m_boardConfigurations.back()[changedPos.row][changedPos.col] = m_board[changedPos.row][changedPos.col]->ToLetter();
+	m_positionKeys.back() = m_position.GetKey();
 }
 
 bool ChessGame::CheckStaleMate() const
@@ -1168,21 +917,7 @@ bool ChessGame::CheckStaleMate() const
 		return false;
 	}
 
-	for (int i = 0; i < 8; i++)
-	{
-		for (int j = 0; j < 8; j++)
-		{
-			if (m_board[i][j] && m_board[i][j]->GetColor() == m_turn)
-			{
-				PositionList possibleMoves = GetPossibleMoves(Position(i, j));
-				if (!possibleMoves.empty())
-				{
-					return false;
-				}
-			}
-		}
-	}
-	return true;
+	return !m_position.HasLegalMove();
 }
 
 bool ChessGame::CheckCheckMate() const
@@ -1195,306 +930,25 @@ bool ChessGame::CheckCheckMate() const
 		return false;
 	}
 
-	Position checkPiecePos;
-	PieceList checkPieces = GetCheckPieces(checkPiecePos);
-
-	PositionList kingPossibleMoves = GetPossibleMoves(m_kingPositions[(int)m_turn]);
-
-	if (!kingPossibleMoves.empty())
-	{
-		return false;
-	}
-	if (checkPieces.size() > 1)
-	{
-		//Notify(ENotification::GameOver);
-		return true;
-	}
-
-	if (CheckPieceCanBeCaptured(checkPiecePos))
-	{
-		return false;
-	}
-
-	if (checkPieces.front()->Is({ EType::King, EType::Pawn, EType::Horse }))
-	{
-		return true;
-	}
-
-	PositionList toBlockPositions = GetToBlockPositions(checkPiecePos);
-
-	if (toBlockPositions.empty())
-	{
-		//Notify(ENotification::GameOver);
-		return true;
-	}
-	if (KingsWayCanBeBlocked(toBlockPositions))
-	{
-		return false;
-	}
-
-	//Notify(ENotification::GameOver);
-	return true;
-}
-
-bool ChessGame::CheckThreeFoldRepetition()
-{
-	for (auto it : m_boardConfigFrequency)
-	{
-		if (it.second >= 3)
-		{
-			return true;
-		}
-	}
-	return false;
-}
-
-bool ChessGame::CheckPieceCanBeCaptured(const Position& checkPiecePos) const
-{
-	for (int i = 0; i < 8; i++)
-	{
-		for (int j = 0; j < 8; j++)
-		{
-			if (m_board[i][j] && m_board[i][j]->GetColor() == m_turn)
-			{
-				PositionList ownPiecePositions = GetPossibleMoves(Position(i, j));
-				for (auto pos : ownPiecePositions)
-				{
-					if (pos == checkPiecePos)
-					{
-						return true;
-					}
-				}
-			}
-		}
-	}
-	return false;
+	return !m_position.HasLegalMove();
 }
 
-bool ChessGame::CanBeCaptured(const ArrayBoard& board, Position toCapturePos) const
+bool ChessGame::CheckThreeFoldRepetition() const
 {
-	EColor pieceColor = board[toCapturePos.row][toCapturePos.col]->GetColor();
+	// Only positions with the same player to move can repeat the current one //
+	std::uint64_t currentKey = m_positionKeys.back();
+	int repetitions = 1;
 
-	for (int i = 0; i < 8; i++)
+	for (int i = (int)m_positionKeys.size() - 3; i >= m_lastIrreversibleMove; i -= 2)
 	{
-		for (int j = 0; j < 8; j++)
+		if (m_positionKeys[i] == currentKey && ++repetitions >= 3)
 		{
-			if (board[i][j] && board[i][j]->GetColor() != pieceColor)
-			{
-				Position atackingPiecePosition(i, j);
-				PositionList enemyPiecePositions = board[i][j]->GetPattern(atackingPiecePosition,
-					std::bind(&ChessGame::GetPiece, this, std::placeholders::_1, board));
-
-				for (auto pos : enemyPiecePositions)
-				{
-					if (pos == toCapturePos)
-					{
-						return true;
-					}
-				}
-			}
-		}
-	}
-	return false;
-}
-
-bool ChessGame::KingsWayCanBeBlocked(const PositionList& toBlockPositions) const
-{
-	for (int i = 0; i < 8; i++)
-	{
-		for (int j = 0; j < 8; j++)
-		{
-			if (m_board[i][j] && m_board[i][j]->GetColor() == m_turn)
-			{
-				PositionList possibleMoves = GetPossibleMoves(Position(i, j));
-				for (auto pos : toBlockPositions)
-				{
-					if (std::find(possibleMoves.begin(), possibleMoves.end(), pos) != possibleMoves.end())
-					{
-						return true;
-					}
-				}
-			}
+			return true;
 		}
 	}
 	return false;
 }
 
-void ChessGame::AddCastle(Position kingPosition, PositionList& kingPossibleMoves) const
-{
-	PiecePtr king = m_board[kingPosition.row][kingPosition.col];
-
-	ArrayBoard boardAfterMove = m_board;
-
-	// Add Left Castle //
-
-	PositionList toCheckPositions = { kingPosition,Position(kingPosition.row,kingPosition.col - 1)
-		, Position(kingPosition.row,kingPosition.col - 2) };
-
-	if (m_castle[(int)king->GetColor()][0] == true)
-	{
-		if (m_board[kingPosition.row][0] && m_board[kingPosition.row][0]->Is(EType::Rook)
-			&& m_board[kingPosition.row][0]->GetColor() == m_turn)
-		{
-			if (!m_board[kingPosition.row][kingPosition.col - 1] && !m_board[kingPosition.row][kingPosition.col - 2] && !m_board[kingPosition.row][kingPosition.col - 3])
-			{
-				bool leftCastle = true;
-				for (auto pos : toCheckPositions)
-				{
-					if (pos != kingPosition)
-					{
-						boardAfterMove[pos.row][pos.col] = boardAfterMove[pos.row][pos.col + 1];
-						boardAfterMove[pos.row][pos.col + 1].reset();
-					}
-
-					if (CanBeCaptured(boardAfterMove, pos))
-					{
-						leftCastle = false;
-						break;
-					}
-				}
-
-				if (leftCastle)
-					kingPossibleMoves.push_back(Position(kingPosition.row, kingPosition.col - 2));
-			}
-		}
-	}
-
-	// Add Right Castle //
-
-	boardAfterMove = m_board;
-
-	toCheckPositions = { kingPosition,Position(kingPosition.row,kingPosition.col + 1)
-		, Position(kingPosition.row,kingPosition.col + 2) };
-
-	if (m_castle[(int)king->GetColor()][1] == true)
-	{
-		if (m_board[kingPosition.row][7] && m_board[kingPosition.row][7]->GetType() == EType::Rook
-			&& m_board[kingPosition.row][7]->GetColor() == m_turn)
-		{
-			if (!m_board[kingPosition.row][kingPosition.col + 1] && !m_board[kingPosition.row][kingPosition.col + 2])
-			{
-				bool rightCastle = true;
-				for (auto pos : toCheckPositions)
-				{
-					if (pos != kingPosition)
-					{
-						boardAfterMove[pos.row][pos.col] = boardAfterMove[pos.row][pos.col - 1];
-						boardAfterMove[pos.row][pos.col - 1].reset();
-					}
-
-					if (CanBeCaptured(boardAfterMove, pos))
-					{
-						rightCastle = false;
-						break;
-					}
-				}
-
-				if (rightCastle)
-					kingPossibleMoves.push_back(Position(kingPosition.row, kingPosition.col + 2));
-			}
-		}
-	}
-}
-
-void ChessGame::ConvertMoveToPositions(std::string& move, Position& initialPos, Position& finalPos)
-{
-	// Verify Castle //
-
-	if (move == "0-0" || move == "0-0-0")
-	{
-		if (m_turn == EColor::White)
-			initialPos.row = finalPos.row = 7;
-		else
-			initialPos.row = finalPos.row = 0;
-
-		initialPos.col = 4;
-
-		finalPos.col = (move == "0-0") ? 6 : 2;
-		return;
-	}
-
-	// End of Verify Castle //
-
-	int pos = move.length();
-
-	char finalRow = move[pos - 1];
-	char finalCol = move[pos - 2];
-
-	finalPos.row = 8 - (finalRow - '0');
-	finalPos.col = TABLE_COLUMNS.find(finalCol);
-
-	char pieceLetter = move[0];
-	EType pieceType = Piece::GetTypeFromLetter(pieceLetter);
-
-	initialPos = Position(-1, -1);
-
-	// New Code //
-
-	if (move.length() == 5)
-	{
-		initialPos.col = TABLE_COLUMNS.find(move[1]);
-		initialPos.row = 8 - (move[2] - '0');
-		return;
-	}
-	else if (move.length() == 4)
-	{
-		if (move[1] >= '0' && move[1] <= '8')   // If is row // 
-		{
-			initialPos.row = 8 - (move[1] - '0');
-		}
-		else  // If is col // 
-		{
-			initialPos.col = TABLE_COLUMNS.find(move[1]);
-		}
-	}
-	else if (move.length() == 3)
-	{
-		if (move[0] < 'A' || move[0]>'H')
-		{
-			if (move[0] >= '0' && move[0] <= '8')   // If is row // 
-			{
-				initialPos.row = 8 - (move[0] - '0');
-			}
-			else  // If is col // 
-			{
-				initialPos.col = TABLE_COLUMNS.find(move[0]);
-			}
-		}
-	}
-
-	for (int i = 0; i < 8; i++)
-	{
-		for (int j = 0; j < 8; j++)
-		{
-			if (m_board[i][j] && m_board[i][j]->GetColor() == m_turn && m_board[i][j]->GetType() == pieceType)
-			{
-				PositionList possibleMoves = GetPossibleMoves(Position(i, j));
-				if (std::find(possibleMoves.begin(), possibleMoves.end(), finalPos) != possibleMoves.end())
-				{
-					if (initialPos.row == -1 && initialPos.col == -1)
-					{
-						initialPos = Position(i, j);
-						return;
-					}
-					else if (i == initialPos.row || j == initialPos.col)
-					{
-						initialPos = Position(i, j);
-						return;
-					}
-				}
-			}
-		}
-	}
-}
-
-BoardPosition ChessGame::ConvertToBoardPosition(Position pos)
-{
-	BoardPosition boardPos;
-	boardPos.first = TABLE_ROWS[pos.row];;
-	boardPos.second = TABLE_COLUMNS[pos.col];
-	return boardPos;
-}
-
 void ChessGame::NotifyMoveMade(Position init, Position fin)
 {
 	for (auto it = m_listeners.begin(); it != m_listeners.end(); it++)
@@ -2,18 +2,19 @@
 
 #include "IChessGame.h"
 #include "Piece.h"
+#include "BitboardPosition.h"
 #include "PGNBuilder.h"
 #include "ChessTimer.h"
+#include "PGNReader.h"
 
 #include <array>
-#include <unordered_map>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <string_view>
 
-using ArrayBoard = std::array<std::array<PiecePtr, 8>, 8>;
-using ChessMap = std::unordered_map<std::array<std::array<char, 8>, 8>, int, struct HashFunctor>;
 using ChessVector = std::vector<std::array<std::array<char, 8>, 8>>;
 using CastleValues = std::array<std::array<bool, 2>, 2>;
-using BoardPosition = std::pair<char, char>;
 
 enum class EGameState
 {
@@ -37,39 +38,39 @@ enum class ENotification
 	Resume
 };
 
-struct HashFunctor {
-	std::size_t operator()(const std::array<std::array<char, 8>, 8>& data) const
-	{
-		std::size_t seed = 0;
-		for (const auto& row : data) 
-		{
-			for (char element : row) 
-			{
-				// Combine the hash of each element in the data structure
-				seed ^= std::hash<char>{}(element)+0x9e3779b9 + (seed << 6) + (seed >> 2);
-			}
-		}
-		return seed;
-	}
+// Everything needed to take back one move made by ChessGame //
+struct MoveRecord
+{
+	UndoInfo undo;
+
+	PiecePtr movedPiece;	// Still the pawn when the move was an upgrade
+	PiecePtr capturedPiece;
+	Position capturedPos;
+
+	EGameState state;		// The state before the move
+	int turnCount;
+	int lastIrreversibleMove;
+	std::chrono::milliseconds increment;	// Added to the mover's clock
 };
 
+using MoveHistory = std::vector<MoveRecord>;
+
 struct ChessData
 {
 	ArrayBoard board;
+	BitboardPosition position;
 	EColor turn;
 	int turnCount;
 
-	PositionList kingPositions;
-
 	IPieceList whitePiecesCaptured;
 	IPieceList blackPiecesCaptured;
 
 	EGameState state;
 
-	CastleValues castle;
-
-	ChessMap boardConfigFrequency;
 	ChessVector boardConfigurations;
+	std::vector<std::uint64_t> positionKeys;
+	int lastIrreversibleMove;
+	MoveHistory history;
 
 	PGNBuilder PGNFormat;
 
@@ -93,6 +94,11 @@ public:
 
 	IPiecePtr GetIPiecePtr(Position pos) const override;
 	PositionList GetPossibleMoves(Position currentPos) const override;
+	void GetPossibleMoves(Position currentPos, FixedMoveList& moves) const override;
+	const ChessMoveList& GetAllPossibleMoves() const override;
+	bool IsAttacked(Position pos, EColor attackerColor) const override;
+	PositionList GetAttackers(Position pos, EColor attackerColor) const override;
+	int StaticExchange(Position initialPos, Position finalPos) const override;
 	IPieceList GetCapturedPieces(EColor color) const override;
 	EColor GetCurrentPlayer() const override;
 	CharBoard GetBoardAtIndex(int index) const override;
@@ -106,12 +112,16 @@ public:
 	bool IsCheckState() const override;
 	bool IsCastlingAvailable(EColor color, ESide side) const override;
 
+	std::uint64_t GetPositionKey() const override;
+	int Evaluate() const override;
+
 	// --- Control Virtual Implementations							--- //
 
 	void ResetGame() override;
 	void RestoreGame(const CharBoard& inputConfig, EColor turn = EColor::White, CastleValues castle = { true, true, true, true }) override;
 
 	void MakeMove(Position initialPos, Position finalPos, bool EnableNotification = true, EType upgradeType = EType::Pawn) override;
+	void UndoMove() override;
 	void UpgradePawn(EType upgradeType) override;
 	void DrawOperation(EDrawOperation op) override;
 		
@@ -131,6 +141,9 @@ public:
 
 	void SetRefreshRate(int milliseconds) override;
 
+	void SetIncrement(int milliseconds) override;
+	int GetIncrement() const override;
+
 	int GetRemainingTime(EColor color) const;
 
 	bool IsPaused() const override;
@@ -145,37 +158,39 @@ public:
 	bool CheckCheckMate() const ;
 	PiecePtr GetPieceFromBoard(Position pos) const;
 
+	const BitboardPosition& GetPosition() const;
+	std::vector<std::uint64_t> GetKeysSinceLastIrreversibleMove() const;
+
+	// Plays moves as PGNReader gives them, stopping at the first one that is not legal; returns how many were played //
+	int PlayMoves(const StringMoveList& moves);
+
 private:
 
 	void InitializeChessGame();
 	void InitializeChessGame(const CharBoard& inputConfig, EColor turn = EColor::White, CastleValues castle = {true, true, true, true});
 
 	void ResetBoard();
+	void MovePieceOnBoard(Position initialPos, Position finalPos);
+
+	static ChessMove ToChessMove(Move move);
+	const AttackMap& GetAttackMap() const;
 
-	PiecePtr GetPiece(Position pos, const ArrayBoard& board) const;
-	PieceList GetCheckPieces(Position& checkPos) const;
-	Position GetMovingDirections(const Position& checkPiecePos) const;
-	PositionList GetToBlockPositions(const Position& checkPiecePos) const;
-	Position GetPiecePositionWithSameTypeThatCanMoveToFinalPosition(Position initialPos, Position finalPos, EType currentPieceType);
 	ChessData GetData() const;
 		
 	void SetData(const ChessData& data);
 	void SetCastleValues(const CastleValues& Castle);
 
-	void MakeMoveFromString(std::string& move);
-	void SwitchTurn();
+	void MakeMoveFromString(std::string_view move);
+	void PlayMove(Move move, const FixedMoveList& legalMoves, bool EnableNotification);
+	std::chrono::milliseconds SwitchTurn();
+	void UndoTurn(std::chrono::milliseconds increment);
 	void UpdateState(EGameState);
-	void SaveConfiguration();
+	void SaveConfiguration(bool irreversibleMove);
+	void UpdateLastConfiguration(Position changedPos);
 
 	bool CheckStaleMate() const;
-	bool CheckThreeFoldRepetition();
-	bool CheckPieceCanBeCaptured(const Position& checkPiecePos) const;
-	bool CanBeCaptured(const ArrayBoard& board, Position toCapturePos) const;
-	bool KingsWayCanBeBlocked(const PositionList& toBlockPositions) const;
+	bool CheckThreeFoldRepetition() const;
 	
-	void AddCastle(Position kingPosition, PositionList& kingPossibleMoves) const;
-	void ConvertMoveToPositions(std::string& move, Position& initialPos, Position& finalPos);
-	static BoardPosition ConvertToBoardPosition(Position pos);
 
 	void NotifyMoveMade(Position init, Position fin);
 	void NotifyPawnUpgrade(Position pos);
@@ -187,20 +202,33 @@ private:
 private:
 
 	ArrayBoard m_board;
+	BitboardPosition m_position;    // Mirrors m_board; also holds the castle values (Row 1 is for White, Column 1 is for left castle)
 	EColor m_turn;
 	int m_turnCount;
 	EGameState m_state;
-	CastleValues m_castle;    // Row 1 is for White and Row 2 is for Black ! Column 1 is for left castle and Column 2 is for right castle
-
-	PositionList m_kingPositions;
 
 	IPieceList m_whitePiecesCaptured;
 	IPieceList m_blackPiecesCaptured;
 
-	ChessMap m_boardConfigFrequency;
 	ChessVector m_boardConfigurations;
+	std::vector<std::uint64_t> m_positionKeys;	// Zobrist key of every position of the game
+	int m_lastIrreversibleMove;					// Index in m_positionKeys of the position after the last capture or pawn move
+	MoveHistory m_history;
 	std::vector<IChessGameListenerWeakPtr> m_listeners;
 
 	PGNBuilder m_PGNFormat;
 	ChessTimer m_timer;
+
+	// Legal moves of the current player, generated on demand for the position with the key below.
+	// Const queries may come from several threads, so filling the cache is locked //
+	mutable std::mutex m_possibleMovesMutex;
+	mutable ChessMoveList m_possibleMoves;
+	mutable std::uint64_t m_possibleMovesKey = 0;
+	mutable bool m_possibleMovesGenerated = false;
+
+	// Attacks of both colors, computed on demand for the position with the key below, locked like the moves //
+	mutable std::mutex m_attackMapMutex;
+	mutable AttackMap m_attackMap;
+	mutable std::uint64_t m_attackMapKey = 0;
+	mutable bool m_attackMapGenerated = false;
 };
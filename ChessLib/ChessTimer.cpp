@@ -4,6 +4,7 @@ ChessTimer::ChessTimer() : m_paused(false)
 , m_isTimerRunning(false)
 , m_turn(EColor::White)
 , m_refreshRate(std::chrono::milliseconds(1))
+, m_increment(std::chrono::milliseconds(0))
 {
 
 }
@@ -16,12 +17,19 @@ ChessTimer::~ChessTimer()
 void ChessTimer::Start()
 {
 	Stop();
+
+	// Set before the thread starts, so a move made right away already gets the increment
+	// and a Stop right after this is not undone by the thread //
+	m_isTimerRunning = true;
 	m_timerThread = std::thread(&ChessTimer::StartTimer, this);
 }
 
 void ChessTimer::Stop()
 {
-	m_isTimerRunning = false;
+	{
+		std::lock_guard<std::mutex> lock(m_timerMutex);
+		m_isTimerRunning = false;
+	}
 	m_timerCV.notify_all();
 	if (m_timerThread.joinable())
 	{
@@ -31,10 +39,16 @@ void ChessTimer::Stop()
 
 void ChessTimer::SetTime(std::chrono::seconds time)
 {
+	std::lock_guard<std::mutex> lock(m_timerMutex);
 	m_whiteRemainingTime.store(time);
 	m_blackRemainingTime.store(time);
 }
 
+void ChessTimer::SetIncrement(std::chrono::milliseconds increment)
+{
+	m_increment = increment;
+}
+
 void ChessTimer::SetRefreshRate(std::chrono::milliseconds rate)
 {
 	m_refreshRate = rate;
@@ -48,7 +62,7 @@ void ChessTimer::SetNotify(std::function<void()> notifyUpdate, std::function<voi
 
 int ChessTimer::GetRemainingTime(EColor color) const
 {
-	switch (m_turn)
+	switch (color)
 	{
 	case EColor::White:
 		return m_whiteRemainingTime.load().count();
@@ -59,25 +73,59 @@ int ChessTimer::GetRemainingTime(EColor color) const
 	}
 }
 
-void ChessTimer::SwitchTurn()
+int ChessTimer::GetIncrement() const
+{
+	return m_increment.load().count();
+}
+
+std::chrono::milliseconds ChessTimer::SwitchTurn()
+{
+	// The clocks are only changed under the lock, the timer thread updates them too //
+	std::lock_guard<std::mutex> lock(m_timerMutex);
+
+	// The player who just moved gets the increment //
+	std::chrono::milliseconds increment(0);
+	if (m_isTimerRunning)
+	{
+		increment = m_increment.load();
+		auto& remainingTime = m_turn == EColor::White ? m_whiteRemainingTime : m_blackRemainingTime;
+		remainingTime.store(remainingTime.load() + increment);
+	}
+
+	m_turn.store(m_turn == EColor::White ? EColor::Black : EColor::White);
+	return increment;
+}
+
+void ChessTimer::UndoTurn(std::chrono::milliseconds increment)
 {
+	std::lock_guard<std::mutex> lock(m_timerMutex);
+
 	m_turn.store(m_turn == EColor::White ? EColor::Black : EColor::White);
+
+	// The player whose move is taken back gives its increment back //
+	auto& remainingTime = m_turn == EColor::White ? m_whiteRemainingTime : m_blackRemainingTime;
+	remainingTime.store(remainingTime.load() - increment);
 }
 
 void ChessTimer::Pause()
 {
+	std::unique_lock<std::mutex> lock(m_timerMutex);
 	if (m_isTimerRunning && !m_paused)
 	{
+		// Set under the lock, so the clock does not run once this returns //
 		m_paused = true;
+		lock.unlock();
 		m_timerCV.notify_all();
 	}
 }
 
 void ChessTimer::Resume()
 {
+	std::unique_lock<std::mutex> lock(m_timerMutex);
 	if (m_isTimerRunning && m_paused)
 	{
 		m_paused = false;
+		lock.unlock();
 		m_timerCV.notify_all();
 	}
 }
@@ -89,10 +137,11 @@ bool ChessTimer::IsPaused() const
 
 void ChessTimer::StartTimer()
 {
-	m_isTimerRunning = true;
 	while (m_isTimerRunning)
 	{
-		NotifyUpdateTimer();
+		// The notifications are only set once the game has a listener //
+		if (NotifyUpdateTimer)
+			NotifyUpdateTimer();
 
 		auto initialTime = std::chrono::steady_clock::now();
 
@@ -103,18 +152,24 @@ void ChessTimer::StartTimer()
 
 		if (m_paused)
 		{
-			m_timerCV.wait(lock, [&] { return !m_paused; });
+			m_timerCV.wait(lock, [&] { return !m_paused || !m_isTimerRunning; });
 		}
 
 		auto& remainingTime = m_turn == EColor::White ? m_whiteRemainingTime : m_blackRemainingTime;
 
-		
 		remainingTime.store(remainingTime.load() - std::chrono::duration_cast<std::chrono::milliseconds>(finalTime - initialTime));
-		if (remainingTime.load().count() <= 0)
+		bool timesUp = remainingTime.load().count() <= 0;
+
+		// The listeners may call back into the timer //
+		lock.unlock();
+
+		if (timesUp)
 		{
 			m_isTimerRunning = false;
-			NotifyUpdateTimer();
-			NotifyTimesUp();
+			if (NotifyUpdateTimer)
+				NotifyUpdateTimer();
+			if (NotifyTimesUp)
+				NotifyTimesUp();
 		}
 	}
 }
@@ -18,12 +18,16 @@ public:
 	void Stop();
 
 	void SetTime(std::chrono::seconds time);
+	void SetIncrement(std::chrono::milliseconds increment);
 	void SetRefreshRate(std::chrono::milliseconds rate);
 	void SetNotify(std::function<void()> notifyUpdate, std::function<void()> notifyTimesUp);
 
 	int GetRemainingTime(EColor color) const;
+	int GetIncrement() const;
 
-	void SwitchTurn();
+	// Returns the increment the player who moved got, for UndoTurn to take back //
+	std::chrono::milliseconds SwitchTurn();
+	void UndoTurn(std::chrono::milliseconds increment);
 
 	void Pause();
 	void Resume();
@@ -44,6 +48,7 @@ private:
 	std::atomic<std::chrono::milliseconds> m_whiteRemainingTime;
 	std::atomic<std::chrono::milliseconds> m_blackRemainingTime;
 	std::atomic<std::chrono::milliseconds> m_refreshRate;
+	std::atomic<std::chrono::milliseconds> m_increment;
 
 	std::atomic<EColor> m_turn;
 	std::function<void()> NotifyUpdateTimer;
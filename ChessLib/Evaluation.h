@@ -0,0 +1,23 @@
+#pragma once
+
+#include <array>
+
+// Material and piece-square values of every piece on every square, for the middlegame and the endgame.
+// Black values are negated, so the sum over all pieces is the score from White's side.
+// BitboardPosition keeps these sums up to date as pieces are set and removed.
+
+namespace Evaluation
+{
+	extern const std::array<std::array<std::array<int, 64>, 6>, 2> Middlegame;	// indexed by EColor, EType and square
+	extern const std::array<std::array<std::array<int, 64>, 6>, 2> Endgame;		// indexed by EColor, EType and square
+
+	// Plain material for ordering captures and counting exchanges, indexed by EType //
+	extern const std::array<int, 6> PieceValues;
+
+	// How much each piece moves the game away from the endgame, indexed by EType //
+	extern const std::array<int, 6> Phase;
+	const int MAX_PHASE = 24;
+
+	// Blends the two scores by the phase, which is clamped to MAX_PHASE after upgrades //
+	int Taper(int middlegame, int endgame, int phase);
+}
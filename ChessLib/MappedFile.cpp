@@ -0,0 +1,181 @@
+#include "MappedFile.h"
+
+#include <cerrno>
+#include <cstdint>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ---		Local Static Functions													--- //
+
+#ifdef _WIN32
+using FileHandle = HANDLE;
+#else
+using FileHandle = int;
+#endif
+
+// The view keeps the file open, so the handle can be closed right after mapping //
+static bool MapFile(FileHandle file, const char*& data, std::size_t& size)
+{
+#ifdef _WIN32
+	LARGE_INTEGER fileSize;
+	if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0
+		|| (unsigned long long)fileSize.QuadPart > SIZE_MAX)
+	{
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping)
+		return false;
+
+	const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!view)
+		return false;
+
+	data = static_cast<const char*>(view);
+	size = (std::size_t)fileSize.QuadPart;
+#else
+	struct stat status;
+	if (fstat(file, &status) != 0 || !S_ISREG(status.st_mode) || status.st_size == 0)
+		return false;
+
+	void* view = mmap(nullptr, (std::size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+	if (view == MAP_FAILED)
+		return false;
+
+	madvise(view, (std::size_t)status.st_size, MADV_SEQUENTIAL);
+
+	data = static_cast<const char*>(view);
+	size = (std::size_t)status.st_size;
+#endif
+	return true;
+}
+
+// Pipes have no size, so they are read in chunks from the open handle until they end //
+static bool ReadAll(FileHandle file, std::string& buffer)
+{
+	const std::size_t CHUNK_SIZE = 1 << 16;
+	while (true)
+	{
+		std::size_t size = buffer.size();
+		buffer.resize(size + CHUNK_SIZE);
+
+#ifdef _WIN32
+		DWORD count = 0;
+		if (!::ReadFile(file, &buffer[size], (DWORD)CHUNK_SIZE, &count, nullptr))
+		{
+			// The writer closing a pipe ends it like the end of a file //
+			buffer.resize(size);
+			return GetLastError() == ERROR_BROKEN_PIPE;
+		}
+#else
+		ssize_t count = read(file, &buffer[size], CHUNK_SIZE);
+		if (count < 0)
+		{
+			buffer.resize(size);
+			if (errno == EINTR)
+				continue;
+			return false;
+		}
+#endif
+
+		buffer.resize(size + (std::size_t)count);
+		if (count == 0)
+			return true;
+	}
+}
+
+// ------------------------------------------------------------------------------------ //
+
+MappedFile::MappedFile()
+	: m_data(nullptr)
+	, m_size(0)
+	, m_mapped(false)
+{
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+bool MappedFile::Open(const std::string& fileName)
+{
+	Close();
+
+	// Opened once: a pipe opened a second time would wait for another writer //
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+#else
+	int file = open(fileName.c_str(), O_RDONLY);
+	if (file < 0)
+		return false;
+#endif
+
+	bool opened = true;
+	if (MapFile(file, m_data, m_size))
+	{
+		m_mapped = true;
+	}
+	else if (ReadAll(file, m_buffer))
+	{
+		m_data = m_buffer.data();
+		m_size = m_buffer.size();
+	}
+	else
+	{
+		opened = false;
+		Close();
+	}
+
+#ifdef _WIN32
+	CloseHandle(file);
+#else
+	close(file);
+#endif
+	return opened;
+}
+
+void MappedFile::Close()
+{
+	if (m_mapped)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(m_data);
+#else
+		munmap(const_cast<char*>(m_data), m_size);
+#endif
+	}
+
+	m_data = nullptr;
+	m_size = 0;
+	m_mapped = false;
+
+	m_buffer.clear();
+	m_buffer.shrink_to_fit();
+}
+
+std::string_view MappedFile::GetText() const
+{
+	return std::string_view(m_data, m_size);
+}
+
+bool MappedFile::IsMapped() const
+{
+	return m_mapped;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read-only view of a whole file. Regular files are memory mapped, so reading them copies nothing;
+// pipes, devices and files that can not be mapped are read into a buffer instead.
+class MappedFile
+{
+public:
+	MappedFile();
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool Open(const std::string& fileName);
+	void Close();
+
+	// Valid until the file is closed //
+	std::string_view GetText() const;
+
+	// False when the file was read into a buffer //
+	bool IsMapped() const;
+
+private:
+	const char* m_data;
+	std::size_t m_size;
+	bool m_mapped;
+
+	std::string m_buffer;	// Holds the file when it is not mapped
+};
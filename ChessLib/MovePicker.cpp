@@ -0,0 +1,213 @@
+#include "MovePicker.h"
+
+#include "Evaluation.h"
+
+#include <utility>
+
+// ---		Local Static Functions													--- //
+
+// Puts losing captures below 0, under every other capture //
+static const int LOSING_CAPTURE_PENALTY = 1000000;
+
+// ------------------------------------------------------------------------------------ //
+
+MovePicker::MovePicker(const BitboardPosition& position, Move hashMove, const std::array<Move, 2>& killers,
+	Move counterMove, const HistoryTable& history)
+	: m_position(position)
+	, m_history(history)
+	, m_hashMove(hashMove)
+	, m_killers(killers)
+	, m_counterMove(counterMove)
+	, m_stage(EStage::HashMove)
+	, m_capturesOnly(false)
+	, m_capturesEnd(0)
+	, m_captureIndex(0)
+	, m_quietIndex(0)
+{
+}
+
+MovePicker::MovePicker(const BitboardPosition& position, const HistoryTable& history)
+	: m_position(position)
+	, m_history(history)
+	, m_hashMove()
+	, m_killers()
+	, m_counterMove()
+	, m_stage(EStage::GenerateCaptures)
+	, m_capturesOnly(!position.IsInCheck(position.GetTurn()))
+	, m_capturesEnd(0)
+	, m_captureIndex(0)
+	, m_quietIndex(0)
+{
+}
+
+bool MovePicker::Next(Move& move)
+{
+	switch (m_stage)
+	{
+	case EStage::HashMove:
+		m_stage = EStage::GenerateCaptures;
+		if (m_hashMove != Move() && m_position.IsLegal(m_hashMove))
+		{
+			move = m_hashMove;
+			return true;
+		}
+		m_hashMove = Move();
+		return Next(move);
+
+	case EStage::GenerateCaptures:
+		m_position.GenerateLegalMoves(m_moves, EMoveKind::Captures);
+		m_capturesEnd = m_moves.size();
+		for (int i = 0; i < m_capturesEnd; i++)
+		{
+			m_scores[i] = IsLosingCapture(m_moves[i])
+				? ScoreCapture(m_moves[i]) - LOSING_CAPTURE_PENALTY
+				: ScoreCapture(m_moves[i]);
+		}
+		m_stage = EStage::GoodCaptures;
+		return Next(move);
+
+	case EStage::GoodCaptures:
+		while (m_captureIndex < m_capturesEnd)
+		{
+			if (PickBest(m_captureIndex, m_capturesEnd) < 0)
+				break;
+
+			move = m_moves[m_captureIndex++];
+			if (move != m_hashMove)
+				return true;
+		}
+		if (m_capturesOnly)
+		{
+			m_stage = EStage::Done;
+			return false;
+		}
+		m_stage = EStage::FirstKiller;
+		return Next(move);
+
+	case EStage::FirstKiller:
+		m_stage = EStage::SecondKiller;
+		if (IsUsableQuiet(m_killers[0]))
+		{
+			move = m_killers[0];
+			return true;
+		}
+		m_killers[0] = Move();
+		return Next(move);
+
+	case EStage::SecondKiller:
+		m_stage = EStage::CounterMove;
+		if (m_killers[1] != m_killers[0] && IsUsableQuiet(m_killers[1]))
+		{
+			move = m_killers[1];
+			return true;
+		}
+		m_killers[1] = Move();
+		return Next(move);
+
+	case EStage::CounterMove:
+		m_stage = EStage::GenerateQuiets;
+		if (m_counterMove != m_killers[0] && m_counterMove != m_killers[1] && IsUsableQuiet(m_counterMove))
+		{
+			move = m_counterMove;
+			return true;
+		}
+		m_counterMove = Move();
+		return Next(move);
+
+	case EStage::GenerateQuiets:
+	{
+		m_position.GenerateLegalMoves(m_moves, EMoveKind::Quiets);
+
+		const auto& colorHistory = m_history[(int)m_position.GetTurn()];
+		for (int i = m_capturesEnd; i < m_moves.size(); i++)
+		{
+			m_scores[i] = colorHistory[m_moves[i].GetFrom()][m_moves[i].GetTo()];
+		}
+		m_quietIndex = m_capturesEnd;
+		m_stage = EStage::Quiets;
+		return Next(move);
+	}
+
+	case EStage::Quiets:
+		while (m_quietIndex < m_moves.size())
+		{
+			PickBest(m_quietIndex, m_moves.size());
+
+			move = m_moves[m_quietIndex++];
+			if (!IsSpecial(move))
+				return true;
+		}
+		m_stage = EStage::BadCaptures;
+		return Next(move);
+
+	case EStage::BadCaptures:
+		while (m_captureIndex < m_capturesEnd)
+		{
+			PickBest(m_captureIndex, m_capturesEnd);
+
+			move = m_moves[m_captureIndex++];
+			if (move != m_hashMove)
+				return true;
+		}
+		m_stage = EStage::Done;
+		return false;
+
+	default:
+		return false;
+	}
+}
+
+bool MovePicker::IsQuiet(Move move)
+{
+	return move.GetFlag() != EMoveFlag::Capture && move.GetFlag() != EMoveFlag::EnPassant
+		&& move.GetPromotion() == EType::Pawn;
+}
+
+bool MovePicker::IsSpecial(Move move) const
+{
+	return move == m_hashMove || move == m_killers[0] || move == m_killers[1] || move == m_counterMove;
+}
+
+bool MovePicker::IsUsableQuiet(Move move) const
+{
+	return move != Move() && move != m_hashMove && IsQuiet(move) && m_position.IsLegal(move);
+}
+
+bool MovePicker::IsLosingCapture(Move move) const
+{
+	if (move.GetPromotion() != EType::Pawn && move.GetPromotion() != EType::Queen)
+		return true;
+
+	return m_position.StaticExchange(move) < 0;
+}
+
+int MovePicker::ScoreCapture(Move move) const
+{
+	// Most valuable victim first, then least valuable attacker //
+	int score = 0;
+	if (move.GetFlag() == EMoveFlag::Capture || move.GetFlag() == EMoveFlag::EnPassant)
+	{
+		EType victim = move.GetFlag() == EMoveFlag::EnPassant ? EType::Pawn : m_position.GetType(move.GetTo());
+		score = 10 * Evaluation::PieceValues[(int)victim] - Evaluation::PieceValues[(int)m_position.GetType(move.GetFrom())];
+	}
+
+	if (move.GetPromotion() != EType::Pawn)
+	{
+		score += Evaluation::PieceValues[(int)move.GetPromotion()];
+	}
+	return score;
+}
+
+int MovePicker::PickBest(int index, int end)
+{
+	int best = index;
+	for (int i = index + 1; i < end; i++)
+	{
+		if (m_scores[i] > m_scores[best])
+			best = i;
+	}
+	std::swap(m_moves[index], m_moves[best]);
+	std::swap(m_scores[index], m_scores[best]);
+
+	return m_scores[index];
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "BitboardPosition.h"
+
+#include <array>
+
+// How often each quiet move caused a cutoff, indexed by EColor, initial and final square.
+// Every search thread has its own, kept from one search to the next
+using HistoryTable = std::array<std::array<std::array<int, 64>, 64>, 2>;
+
+// Hands out the legal moves of a position best first, generating them only when a stage needs them:
+// the hash move, captures that do not lose material in the static exchange by MVV-LVA, the two killers,
+// the counter move, the quiet moves by history and last the losing captures and minor upgrades.
+// A cutoff on an early stage never generates the quiet moves.
+class MovePicker
+{
+public:
+	MovePicker(const BitboardPosition& position, Move hashMove, const std::array<Move, 2>& killers,
+		Move counterMove, const HistoryTable& history);
+
+	// For the quiescence search: only the captures and queen upgrades that do not lose material,
+	// or every legal move when the player to move is in check
+	MovePicker(const BitboardPosition& position, const HistoryTable& history);
+
+	// Returns false once every legal move was returned //
+	bool Next(Move& move);
+
+	// Neither a capture nor an upgrade //
+	static bool IsQuiet(Move move);
+
+private:
+	enum class EStage
+	{
+		HashMove,
+		GenerateCaptures,
+		GoodCaptures,
+		FirstKiller,
+		SecondKiller,
+		CounterMove,
+		GenerateQuiets,
+		Quiets,
+		BadCaptures,
+		Done
+	};
+
+	bool IsSpecial(Move move) const;
+	bool IsUsableQuiet(Move move) const;
+	bool IsLosingCapture(Move move) const;
+	int ScoreCapture(Move move) const;
+
+	// Moves the best scored of the moves from index to end to index and returns its score //
+	int PickBest(int index, int end);
+
+private:
+	const BitboardPosition& m_position;
+	const HistoryTable& m_history;
+
+	Move m_hashMove;
+	std::array<Move, 2> m_killers;
+	Move m_counterMove;
+
+	EStage m_stage;
+	bool m_capturesOnly;
+
+	// One list and one score array for every stage, so a picker on each ply of the stack stays small:
+	// the captures come first and the quiet moves are added after them.
+	// Losing captures are scored below 0 and stay in the list until the quiet moves are done //
+	FixedMoveList m_moves;
+	std::array<int, FixedMoveList::MAX_MOVES> m_scores;
+	int m_capturesEnd;
+	int m_captureIndex;
+	int m_quietIndex;
+};
@@ -0,0 +1,197 @@
+#include "Nnue.h"
+#include "NnueKernels.h"
+
+#include <cstring>
+#include <fstream>
+
+using namespace Nnue;
+
+// ---		Local Static Functions													--- //
+
+using ForwardFunction = std::int32_t(*)(const std::int16_t*, const std::int16_t*, const std::int16_t*);
+
+static ForwardFunction GetForwardFunction(EKernel kernel)
+{
+	switch (kernel)
+	{
+	case EKernel::Sse41:
+		return Kernels::ForwardSse41;
+	case EKernel::Avx2:
+		return Kernels::ForwardAvx2;
+	default:
+		return Kernels::ForwardScalar;
+	}
+}
+
+// The values are stored little endian, like they are in memory on x86 //
+template<class T>
+static bool ReadValues(std::istream& stream, T* values, std::size_t count)
+{
+	stream.read(reinterpret_cast<char*>(values), count * sizeof(T));
+	return (bool)stream;
+}
+
+// ------------------------------------------------------------------------------------ //
+
+bool Nnue::IsKernelSupported(EKernel kernel)
+{
+	switch (kernel)
+	{
+	case EKernel::Sse41:
+		return Kernels::HasSse41();
+	case EKernel::Avx2:
+		return Kernels::HasAvx2();
+	default:
+		return true;
+	}
+}
+
+EKernel Nnue::GetBestKernel()
+{
+	static const EKernel best = IsKernelSupported(EKernel::Avx2) ? EKernel::Avx2
+		: IsKernelSupported(EKernel::Sse41) ? EKernel::Sse41
+		: EKernel::Scalar;
+
+	return best;
+}
+
+const char* Nnue::GetKernelName(EKernel kernel)
+{
+	switch (kernel)
+	{
+	case EKernel::Sse41:
+		return "SSE4.1";
+	case EKernel::Avx2:
+		return "AVX2";
+	default:
+		return "Scalar";
+	}
+}
+
+// ---		Network																	--- //
+
+Network::Network()
+	: m_featureWeights(INPUTS * HIDDEN)
+	, m_outputBias(0)
+{
+}
+
+std::unique_ptr<Network> Network::Load(const std::string& fileName)
+{
+	std::ifstream file(fileName, std::ios::binary);
+	if (!file)
+		return nullptr;
+
+	char magic[4];
+	std::uint32_t inputs, hidden;
+	if (!ReadValues(file, magic, 4) || std::memcmp(magic, "CLNN", 4) != 0
+		|| !ReadValues(file, &inputs, 1) || !ReadValues(file, &hidden, 1)
+		|| inputs != INPUTS || hidden != HIDDEN)
+	{
+		return nullptr;
+	}
+
+	std::unique_ptr<Network> network(new Network());
+
+	if (!ReadValues(file, network->m_featureWeights.data(), network->m_featureWeights.size())
+		|| !ReadValues(file, network->m_featureBiases.data(), HIDDEN)
+		|| !ReadValues(file, network->m_outputWeights.data(), 2 * HIDDEN)
+		|| !ReadValues(file, &network->m_outputBias, 1))
+	{
+		return nullptr;
+	}
+
+	// Trailing bytes mean the file was written for another layout //
+	if (file.peek() != std::ifstream::traits_type::eof())
+		return nullptr;
+
+	return network;
+}
+
+const std::int16_t* Network::GetFeatureWeights(int feature) const
+{
+	return m_featureWeights.data() + feature * HIDDEN;
+}
+
+const std::int16_t* Network::GetFeatureBiases() const
+{
+	return m_featureBiases.data();
+}
+
+int Network::Forward(const std::int16_t* us, const std::int16_t* them) const
+{
+	static const ForwardFunction forward = GetForwardFunction(GetBestKernel());
+
+	std::int64_t output = (std::int64_t)forward(us, them, m_outputWeights.data()) + m_outputBias;
+	return (int)(output * SCALE / (QA * QB));
+}
+
+int Network::Forward(const std::int16_t* us, const std::int16_t* them, EKernel kernel) const
+{
+	std::int64_t output = (std::int64_t)GetForwardFunction(kernel)(us, them, m_outputWeights.data()) + m_outputBias;
+	return (int)(output * SCALE / (QA * QB));
+}
+
+int Network::GetFeature(EColor perspective, EColor color, EType type, int square)
+{
+	// Black sees the board upside down, so both players see their pieces moving up //
+	int relativeSquare = perspective == EColor::White ? square : square ^ 56;
+	int side = color == perspective ? 0 : 1;
+
+	return (side * 6 + (int)type) * 64 + relativeSquare;
+}
+
+// ---		Accumulator																--- //
+
+Accumulator::Accumulator(const Network& network)
+	: m_network(network)
+{
+	Clear();
+}
+
+void Accumulator::Clear()
+{
+	for (auto& values : m_values)
+		std::memcpy(values.data(), m_network.GetFeatureBiases(), sizeof(values));
+}
+
+void Accumulator::AddPiece(EColor color, EType type, int square)
+{
+	for (int perspective = 0; perspective < 2; perspective++)
+	{
+		const std::int16_t* weights = m_network.GetFeatureWeights(Network::GetFeature((EColor)perspective, color, type, square));
+		auto& values = m_values[perspective];
+
+		for (int i = 0; i < HIDDEN; i++)
+			values[i] += weights[i];
+	}
+}
+
+void Accumulator::RemovePiece(EColor color, EType type, int square)
+{
+	for (int perspective = 0; perspective < 2; perspective++)
+	{
+		const std::int16_t* weights = m_network.GetFeatureWeights(Network::GetFeature((EColor)perspective, color, type, square));
+		auto& values = m_values[perspective];
+
+		for (int i = 0; i < HIDDEN; i++)
+			values[i] -= weights[i];
+	}
+}
+
+int Accumulator::Evaluate(EColor turn) const
+{
+	int us = (int)turn;
+	return m_network.Forward(m_values[us].data(), m_values[1 - us].data());
+}
+
+int Accumulator::Evaluate(EColor turn, EKernel kernel) const
+{
+	int us = (int)turn;
+	return m_network.Forward(m_values[us].data(), m_values[1 - us].data(), kernel);
+}
+
+const Network& Accumulator::GetNetwork() const
+{
+	return m_network;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Enums.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// A small quantized network evaluating positions, used by the search instead of the Evaluation tables
+// once IChessEngine::LoadNetwork succeeds.
+//
+// Each piece switches on one of 768 inputs (own or enemy, type, square) for both players, seen from their side
+// of the board. The first layer sums the weights of the active inputs into one accumulator per player, which
+// is updated as pieces are set and removed. The output layer reads both accumulators, the one of the player
+// to move first, through a clipped ReLU.
+//
+// File layout, little endian:
+//		char[4]		"CLNN"
+//		uint32		INPUTS
+//		uint32		HIDDEN
+//		int16		feature weights [INPUTS][HIDDEN]
+//		int16		feature biases [HIDDEN]
+//		int16		output weights [2 * HIDDEN]
+//		int32		output bias
+
+namespace Nnue
+{
+	const int INPUTS = 768;
+	const int HIDDEN = 256;
+
+	const int QA = 255;		// Scale of the first layer, also where the ReLU clips
+	const int QB = 64;		// Scale of the output weights
+	const int SCALE = 400;	// Output units per centipawn
+
+	// Implementations of the output layer, each needs the instructions it is named after //
+	enum class EKernel
+	{
+		Scalar,
+		Sse41,
+		Avx2
+	};
+
+	bool IsKernelSupported(EKernel kernel);
+	EKernel GetBestKernel();	// Detected once, at the first call
+	const char* GetKernelName(EKernel kernel);
+
+	class Network
+	{
+	public:
+		// Returns nullptr if the file can not be read or does not hold a network of this size //
+		static std::unique_ptr<Network> Load(const std::string& fileName);
+
+		const std::int16_t* GetFeatureWeights(int feature) const;
+		const std::int16_t* GetFeatureBiases() const;
+
+		// Centipawns for the player to move, whose accumulator is us //
+		int Forward(const std::int16_t* us, const std::int16_t* them) const;
+		int Forward(const std::int16_t* us, const std::int16_t* them, EKernel kernel) const;
+
+		static int GetFeature(EColor perspective, EColor color, EType type, int square);
+
+	private:
+		Network();
+
+	private:
+		std::vector<std::int16_t> m_featureWeights;
+		std::array<std::int16_t, HIDDEN> m_featureBiases;
+		std::array<std::int16_t, 2 * HIDDEN> m_outputWeights;
+		std::int32_t m_outputBias;
+	};
+
+	// First layer output of one position for both players, updated piece by piece //
+	class Accumulator
+	{
+	public:
+		explicit Accumulator(const Network& network);
+
+		void Clear();
+		void AddPiece(EColor color, EType type, int square);
+		void RemovePiece(EColor color, EType type, int square);
+
+		int Evaluate(EColor turn) const;
+		int Evaluate(EColor turn, EKernel kernel) const;
+
+		const Network& GetNetwork() const;
+
+	private:
+		const Network& m_network;
+		std::array<std::array<std::int16_t, HIDDEN>, 2> m_values;	// indexed by the EColor of the player
+	};
+}
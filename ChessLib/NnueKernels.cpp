@@ -0,0 +1,128 @@
+#include "NnueKernels.h"
+#include "Nnue.h"
+
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CHESS_NNUE_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC emits any intrinsic, GCC and Clang only inside functions compiled for its instruction set //
+#if defined(__GNUC__) || defined(__clang__)
+#define CHESS_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CHESS_TARGET(isa)
+#endif
+
+using namespace Nnue;
+
+bool Kernels::HasSse41()
+{
+#if defined(CHESS_NNUE_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	return (info[2] & (1 << 19)) != 0;
+#elif defined(CHESS_NNUE_X86)
+	return __builtin_cpu_supports("sse4.1");
+#else
+	return false;
+#endif
+}
+
+bool Kernels::HasAvx2()
+{
+#if defined(CHESS_NNUE_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+
+	// The OS must also save the upper halves of the registers //
+	bool osSavesAvx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+	if (!osSavesAvx)
+		return false;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#elif defined(CHESS_NNUE_X86)
+	return __builtin_cpu_supports("avx2");
+#else
+	return false;
+#endif
+}
+
+std::int32_t Kernels::ForwardScalar(const std::int16_t* us, const std::int16_t* them, const std::int16_t* weights)
+{
+	std::int32_t sum = 0;
+
+	for (int i = 0; i < HIDDEN; i++)
+	{
+		sum += std::min(std::max((int)us[i], 0), QA) * weights[i];
+		sum += std::min(std::max((int)them[i], 0), QA) * weights[HIDDEN + i];
+	}
+	return sum;
+}
+
+#ifdef CHESS_NNUE_X86
+
+CHESS_TARGET("sse4.1")
+std::int32_t Kernels::ForwardSse41(const std::int16_t* us, const std::int16_t* them, const std::int16_t* weights)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i clip = _mm_set1_epi16(QA);
+	__m128i sum = _mm_setzero_si128();
+
+	for (int i = 0; i < HIDDEN; i += 8)
+	{
+		__m128i ourValues = _mm_min_epi16(_mm_max_epi16(_mm_loadu_si128((const __m128i*)(us + i)), zero), clip);
+		__m128i theirValues = _mm_min_epi16(_mm_max_epi16(_mm_loadu_si128((const __m128i*)(them + i)), zero), clip);
+
+		// Pairs of products are added into 32-bit lanes, so the clipped values never overflow //
+		sum = _mm_add_epi32(sum, _mm_madd_epi16(ourValues, _mm_loadu_si128((const __m128i*)(weights + i))));
+		sum = _mm_add_epi32(sum, _mm_madd_epi16(theirValues, _mm_loadu_si128((const __m128i*)(weights + HIDDEN + i))));
+	}
+
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+	return _mm_extract_epi32(sum, 0);
+}
+
+CHESS_TARGET("avx2")
+std::int32_t Kernels::ForwardAvx2(const std::int16_t* us, const std::int16_t* them, const std::int16_t* weights)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i clip = _mm256_set1_epi16(QA);
+	__m256i sum = _mm256_setzero_si256();
+
+	for (int i = 0; i < HIDDEN; i += 16)
+	{
+		__m256i ourValues = _mm256_min_epi16(_mm256_max_epi16(_mm256_loadu_si256((const __m256i*)(us + i)), zero), clip);
+		__m256i theirValues = _mm256_min_epi16(_mm256_max_epi16(_mm256_loadu_si256((const __m256i*)(them + i)), zero), clip);
+
+		sum = _mm256_add_epi32(sum, _mm256_madd_epi16(ourValues, _mm256_loadu_si256((const __m256i*)(weights + i))));
+		sum = _mm256_add_epi32(sum, _mm256_madd_epi16(theirValues, _mm256_loadu_si256((const __m256i*)(weights + HIDDEN + i))));
+	}
+
+	__m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+	half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+	half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+	return _mm_cvtsi128_si32(half);
+}
+
+#else
+
+// Never selected without x86, kept so every kernel links //
+
+std::int32_t Kernels::ForwardSse41(const std::int16_t* us, const std::int16_t* them, const std::int16_t* weights)
+{
+	return ForwardScalar(us, them, weights);
+}
+
+std::int32_t Kernels::ForwardAvx2(const std::int16_t* us, const std::int16_t* them, const std::int16_t* weights)
+{
+	return ForwardScalar(us, them, weights);
+}
+
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+// Output layer of the network: the sum of the clipped accumulators of both players times their output weights.
+// The SIMD versions are compiled for their instruction set whatever the project flags are,
+// so they may only be called once the CPU reports it.
+
+namespace Nnue
+{
+	namespace Kernels
+	{
+		bool HasSse41();
+		bool HasAvx2();
+
+		std::int32_t ForwardScalar(const std::int16_t* us, const std::int16_t* them, const std::int16_t* weights);
+		std::int32_t ForwardSse41(const std::int16_t* us, const std::int16_t* them, const std::int16_t* weights);
+		std::int32_t ForwardAvx2(const std::int16_t* us, const std::int16_t* them, const std::int16_t* weights);
+	}
+}
@@ -13,9 +13,19 @@ std::string PGNBuilder::GetPGNFormat() const
 
 void PGNBuilder::AddMove(const std::string& move)
 {
+	m_moveOffsets.push_back(m_PGNString.length());
 	m_PGNString = m_PGNString + move + " ";
 }
 
+void PGNBuilder::RemoveLastMove()
+{
+	if (m_moveOffsets.empty())
+		return;
+
+	m_PGNString.resize(m_moveOffsets.back());
+	m_moveOffsets.pop_back();
+}
+
 bool PGNBuilder::SaveFormat(const std::string& fileName) const
 {
 	std::ofstream fileStream(fileName);
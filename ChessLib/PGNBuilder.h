@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 class PGNBuilder
 {
@@ -12,11 +13,13 @@ public:
 	std::string GetPGNFormat() const;
 
 	void AddMove(const std::string& move);
+	void RemoveLastMove();
 
 	bool SaveFormat(const std::string& fileName) const;
 
 private:
 
 	std::string m_PGNString;
+	std::vector<std::size_t> m_moveOffsets;	// Where each move starts in m_PGNString
 };
 
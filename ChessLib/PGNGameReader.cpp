@@ -0,0 +1,300 @@
+#include "PGNGameReader.h"
+
+#include <algorithm>
+
+// ---		Local Static Functions													--- //
+
+// Braces do not nest and a semicolon comments out the rest of the line //
+static bool EndsInComment(std::string_view line, bool inComment)
+{
+	for (char c : line)
+	{
+		if (inComment)
+		{
+			if (c == '}')
+				inComment = false;
+		}
+		else if (c == '{')
+		{
+			inComment = true;
+		}
+		else if (c == ';')
+		{
+			break;
+		}
+	}
+	return inComment;
+}
+
+static void ReadTags(const std::string& line, PGNTagList& tags)
+{
+	PGNLexer lexer(line);
+	PGNToken token;
+	while (lexer.Next(token))
+	{
+		if (token.type == EPGNToken::TagPair)
+			tags.emplace_back(std::string(token.text), PGNLexer::Unescape(token.value));
+	}
+}
+
+enum class EGameLine
+{
+	Blank,		// Before the game starts
+	TagPair,
+	MoveText
+};
+
+// Follows the lines of one game, so reading a file and indexing a text split games the same way //
+class GameScanner
+{
+public:
+	GameScanner()
+		: m_started(false)
+		, m_inMoveText(false)
+		, m_inComment(false)
+		, m_ended(false)
+		, m_variationDepth(0)
+	{
+	}
+
+	bool IsStarted() const
+	{
+		return m_started;
+	}
+
+	// A line after the result or a tag after the moves starts the next game, the line is left to it.
+	// The blank lines after the result stay with the game //
+	bool StartsNextGame(char first) const
+	{
+		if (m_ended)
+			return first != '\n' && first != '\r';
+
+		return m_inMoveText && !m_inComment && first == '[';
+	}
+
+	// The line without its end of line //
+	EGameLine AddLine(std::string_view line)
+	{
+		if (!m_inMoveText)
+		{
+			if (line.find_first_not_of(" \t") == std::string_view::npos)
+				return EGameLine::Blank;
+
+			m_started = true;
+			if (line[0] == '[')
+				return EGameLine::TagPair;
+
+			m_inMoveText = true;
+		}
+
+		// The end of a comment started on an earlier line is not move text //
+		std::string_view moveText = line;
+		if (m_inComment)
+		{
+			std::size_t end = line.find('}');
+			moveText = end == std::string_view::npos ? std::string_view() : line.substr(end + 1);
+		}
+
+		m_inComment = EndsInComment(line, m_inComment);
+		FindResult(moveText);
+
+		return EGameLine::MoveText;
+	}
+
+private:
+	// The game ends at its result, the results of variations are not its own //
+	void FindResult(std::string_view moveText)
+	{
+		PGNLexer lexer(moveText);
+		PGNToken token;
+		while (!m_ended && lexer.Next(token))
+		{
+			if (token.type == EPGNToken::VariationStart)
+				m_variationDepth++;
+			else if (token.type == EPGNToken::VariationEnd && m_variationDepth > 0)
+				m_variationDepth--;
+			else if (token.type == EPGNToken::Result && m_variationDepth == 0)
+				m_ended = true;
+		}
+	}
+
+private:
+	bool m_started;
+	bool m_inMoveText;
+	bool m_inComment;
+	bool m_ended;
+	int m_variationDepth;
+};
+
+// ------------------------------------------------------------------------------------ //
+
+std::string PGNGame::GetTag(const std::string& name) const
+{
+	for (const auto& tag : tags)
+	{
+		if (tag.first == name)
+			return tag.second;
+	}
+	return std::string();
+}
+
+PGNGameReader::PGNGameReader()
+	: m_offset(0)
+	, m_gameNumber(0)
+{
+}
+
+bool PGNGameReader::Open(const std::string& fileName)
+{
+	// Binary, so the offsets are the bytes of the file //
+	m_file.close();
+	m_file.clear();
+	m_file.open(fileName, std::ios::binary);
+
+	m_offset = 0;
+	m_gameNumber = 0;
+	m_index.clear();
+
+	return m_file.is_open();
+}
+
+bool PGNGameReader::ReadGame(PGNGame& game)
+{
+	return ReadNextGame(&game, game.offset);
+}
+
+bool PGNGameReader::SkipGame()
+{
+	std::uint64_t offset;
+	return ReadNextGame(nullptr, offset);
+}
+
+std::size_t PGNGameReader::GetGameNumber() const
+{
+	return m_gameNumber;
+}
+
+bool PGNGameReader::SeekGame(std::size_t gameNumber)
+{
+	if (m_index.empty())
+		BuildIndex();
+
+	if (gameNumber >= m_index.size() || !Seek(m_index[gameNumber]))
+		return false;
+
+	m_gameNumber = gameNumber;
+	return true;
+}
+
+void PGNGameReader::BuildIndex()
+{
+	std::uint64_t currentOffset = m_offset;
+	std::size_t currentGameNumber = m_gameNumber;
+
+	m_index.clear();
+	if (!Seek(0))
+		return;
+
+	std::uint64_t offset;
+	while (ReadNextGame(nullptr, offset))
+		m_index.push_back(offset);
+
+	Seek(currentOffset);
+	m_gameNumber = currentGameNumber;
+}
+
+const PGNIndex& PGNGameReader::GetIndex() const
+{
+	return m_index;
+}
+
+void PGNGameReader::SetIndex(PGNIndex index)
+{
+	m_index = std::move(index);
+}
+
+bool PGNGameReader::ReadNextGame(PGNGame* game, std::uint64_t& offset)
+{
+	if (game)
+	{
+		game->tags.clear();
+		game->moveText.clear();
+	}
+
+	GameScanner scanner;
+	while (m_file)
+	{
+		int next = m_file.peek();
+		if (next == std::char_traits<char>::eof() || scanner.StartsNextGame((char)next))
+			break;
+
+		std::uint64_t lineOffset = m_offset;
+		std::getline(m_file, m_line);
+		m_offset += m_line.size() + (m_file.eof() ? 0 : 1);
+
+		if (!m_line.empty() && m_line.back() == '\r')
+			m_line.pop_back();
+
+		bool started = scanner.IsStarted();
+		EGameLine line = scanner.AddLine(m_line);
+		if (line == EGameLine::Blank)
+			continue;
+
+		if (!started)
+			offset = lineOffset;
+
+		if (!game)
+			continue;
+
+		if (line == EGameLine::TagPair)
+		{
+			ReadTags(m_line, game->tags);
+		}
+		else
+		{
+			game->moveText += m_line;
+			game->moveText += '\n';
+		}
+	}
+
+	if (scanner.IsStarted())
+		m_gameNumber++;
+
+	return scanner.IsStarted();
+}
+
+PGNIndex PGNGameReader::IndexText(std::string_view text)
+{
+	PGNIndex index;
+
+	std::size_t offset = 0;
+	while (offset < text.size())
+	{
+		GameScanner scanner;
+		while (offset < text.size() && !scanner.StartsNextGame(text[offset]))
+		{
+			std::size_t end = std::min(text.find('\n', offset), text.size());
+
+			std::string_view line = text.substr(offset, end - offset);
+			if (!line.empty() && line.back() == '\r')
+				line.remove_suffix(1);
+
+			bool started = scanner.IsStarted();
+			if (scanner.AddLine(line) != EGameLine::Blank && !started)
+				index.push_back(offset);
+
+			offset = end + 1;
+		}
+	}
+
+	return index;
+}
+
+bool PGNGameReader::Seek(std::uint64_t offset)
+{
+	m_file.clear();
+	m_file.seekg((std::streamoff)offset);
+	m_offset = offset;
+
+	return (bool)m_file;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "PGNLexer.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using PGNIndex = std::vector<std::uint64_t>;	// Where each game starts, in bytes from the start of the file
+
+struct PGNGame
+{
+	PGNTagList tags;		// In file order, values unescaped
+	std::string moveText;	// Every line after the tags, comments and result included
+	std::uint64_t offset;	// Where the game starts in the file
+
+	// Returns an empty string when the game has no such tag //
+	std::string GetTag(const std::string& name) const;
+};
+
+// Reads the games of a PGN file one at a time, a line at a time, so only the current game is in memory.
+// A game ends at its result, where the tags of the next one start, or at the end of the file.
+// The index of game offsets is built by one pass over the file and can be saved and given back later.
+class PGNGameReader
+{
+public:
+	PGNGameReader();
+
+	bool Open(const std::string& fileName);
+
+	// Returns false at the end of the file //
+	bool ReadGame(PGNGame& game);
+	bool SkipGame();
+
+	// The number of the game the next read returns, counting from 0 //
+	std::size_t GetGameNumber() const;
+
+	// Goes to a game by its number, building the index first if there is none //
+	bool SeekGame(std::size_t gameNumber);
+
+	// Scans the whole file for the start of every game and comes back to the current game //
+	void BuildIndex();
+	const PGNIndex& GetIndex() const;
+	void SetIndex(PGNIndex index);
+
+	// The start of every game of a text already in memory, found the way the file is read //
+	static PGNIndex IndexText(std::string_view text);
+
+private:
+	// Reads the next game into game, or only skips it when game is nullptr //
+	bool ReadNextGame(PGNGame* game, std::uint64_t& offset);
+	bool Seek(std::uint64_t offset);
+
+private:
+	std::ifstream m_file;
+	std::uint64_t m_offset;	// Of the next line to read
+	std::size_t m_gameNumber;
+
+	PGNIndex m_index;
+	std::string m_line;		// Reused for every line
+};
@@ -0,0 +1,120 @@
+#include "PGNImporter.h"
+#include "PGNReader.h"
+#include "PGNGameReader.h"
+#include "MappedFile.h"
+#include "ChessGame.h"
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <thread>
+
+// ---		Local Static Functions													--- //
+
+static void ImportGame(ChessGame& game, std::string_view text, PGNImportResult& result)
+{
+	PGNReader reader;
+	reader.LoadFromString(text);
+
+	game.ResetGame();
+
+	const StringMoveList& moves = reader.GetMoves();
+	result.tags = reader.GetTags();
+	result.movesPlayed = game.PlayMoves(moves);
+	result.illegalMove = result.movesPlayed < (int)moves.size() ? moves[result.movesPlayed] : std::string();
+	result.finalBoard = game.GetBoardAtIndex(game.GetNumberOfMoves() - 1);
+	result.turn = game.GetCurrentPlayer();
+}
+
+// ------------------------------------------------------------------------------------ //
+
+bool PGNImportResult::IsValid() const
+{
+	return illegalMove.empty() && error.empty();
+}
+
+PGNImporter::PGNImporter()
+{
+	SetThreadCount(std::max(1, (int)std::thread::hardware_concurrency()));
+}
+
+void PGNImporter::SetThreadCount(int count)
+{
+	m_workers.Resize(std::max(count, 1) - 1);
+}
+
+int PGNImporter::GetThreadCount() const
+{
+	return m_workers.GetSize() + 1;
+}
+
+void PGNImporter::SetGameCheck(PGNGameCheck check)
+{
+	m_check = std::move(check);
+}
+
+PGNImportResults PGNImporter::ImportText(std::string_view text)
+{
+	std::vector<std::string_view> games = SplitGames(text);
+	PGNImportResults results(games.size());
+
+	// Games are handed out one at a time, so a long game does not hold up the others //
+	std::atomic<std::size_t> nextGame(0);
+	auto worker = [this, &games, &results, &nextGame](int)
+	{
+		// Made inside the try and reused for the next games //
+		std::optional<ChessGame> game;
+		for (std::size_t index = nextGame++; index < games.size(); index = nextGame++)
+		{
+			// An exception must not leave the pool thread, it would end the program //
+			try
+			{
+				if (!game)
+					game.emplace();
+
+				ImportGame(*game, games[index], results[index]);
+				if (m_check)
+					m_check(*game, results[index]);
+			}
+			catch (const std::exception& e)
+			{
+				results[index].error = e.what();
+			}
+			catch (...)
+			{
+				results[index].error = "Unknown exception";
+			}
+		}
+	};
+
+	m_workers.Start(worker);
+	worker(0);
+	m_workers.Wait();
+
+	return results;
+}
+
+bool PGNImporter::ImportFile(const std::string& fileName, PGNImportResults& results)
+{
+	MappedFile file;
+	if (!file.Open(fileName))
+		return false;
+
+	results = ImportText(file.GetText());
+	return true;
+}
+
+std::vector<std::string_view> PGNImporter::SplitGames(std::string_view text)
+{
+	PGNIndex index = PGNGameReader::IndexText(text);
+
+	std::vector<std::string_view> games;
+	games.reserve(index.size());
+
+	for (std::size_t i = 0; i < index.size(); i++)
+	{
+		std::size_t end = i + 1 < index.size() ? (std::size_t)index[i + 1] : text.size();
+		games.push_back(text.substr((std::size_t)index[i], end - (std::size_t)index[i]));
+	}
+	return games;
+}
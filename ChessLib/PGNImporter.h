@@ -0,0 +1,55 @@
+#pragma once
+
+#include "PGNLexer.h"
+#include "ThreadPool.h"
+#include "IChessGame.h"
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class ChessGame;
+
+struct PGNImportResult
+{
+	PGNTagList tags;
+	int movesPlayed;			// Legal moves replayed from the start position
+	std::string illegalMove;	// The first move that could not be played, as PGNReader gives it; empty when all were legal
+	CharBoard finalBoard;		// After the last legal move
+	EColor turn;				// The player to move on the final board
+	std::string error;			// What the validation threw, empty when it ran to the end
+
+	bool IsValid() const;
+};
+
+using PGNImportResults = std::vector<PGNImportResult>;
+
+// Runs on the worker once a game is replayed, with the game at its final position //
+using PGNGameCheck = std::function<void(const ChessGame& game, PGNImportResult& result)>;
+
+// Validates the games of a PGN database by replaying them on a pool of workers, each with its own ChessGame.
+// The text is split into games first and the results come back in the order of the games.
+// Games start from the standard position.
+class PGNImporter
+{
+public:
+	PGNImporter();
+
+	// All the threads of the machine by default //
+	void SetThreadCount(int count);
+	int GetThreadCount() const;
+
+	// Further checks of each replayed game; a check that throws marks the game as not valid //
+	void SetGameCheck(PGNGameCheck check);
+
+	PGNImportResults ImportText(std::string_view text);
+	bool ImportFile(const std::string& fileName, PGNImportResults& results);
+
+	// A game ends where the tags of the next one start, as PGNGameReader reads them //
+	static std::vector<std::string_view> SplitGames(std::string_view text);
+
+private:
+	ThreadPool m_workers;	// Runs every worker but the first, which runs on the calling thread
+	PGNGameCheck m_check;
+};
@@ -0,0 +1,239 @@
+#include "PGNLexer.h"
+
+#include <algorithm>
+#include <cctype>
+
+// ---		Local Static Functions													--- //
+
+static bool IsWhitespace(char c)
+{
+	return std::isspace((unsigned char)c) != 0;
+}
+
+static bool IsDigit(char c)
+{
+	return std::isdigit((unsigned char)c) != 0;
+}
+
+static bool IsLetter(char c)
+{
+	return std::isalpha((unsigned char)c) != 0;
+}
+
+static bool IsTagNameCharacter(char c)
+{
+	return std::isalnum((unsigned char)c) != 0 || c == '_';
+}
+
+// Squares, pieces, captures, upgrades and castles //
+static bool IsMoveCharacter(char c)
+{
+	return std::isalnum((unsigned char)c) != 0 || c == '=' || c == '-';
+}
+
+// Results and castles written with zeros //
+static bool IsNumberCharacter(char c)
+{
+	return IsDigit(c) || c == '-' || c == '/';
+}
+
+static bool IsSuffixAnnotation(char c)
+{
+	return c == '!' || c == '?';
+}
+
+// ------------------------------------------------------------------------------------ //
+
+PGNLexer::PGNLexer(std::string_view text)
+	: m_text(text)
+	, m_offset(0)
+{
+}
+
+bool PGNLexer::Next(PGNToken& token)
+{
+	SkipWhitespace();
+	if (m_offset >= m_text.size())
+		return false;
+
+	token.value = std::string_view();
+
+	std::size_t start = m_offset;
+	char c = m_text[m_offset];
+	switch (c)
+	{
+	case '[':
+		ReadTagPair(token);
+		return true;
+
+	case '{':
+		m_offset++;
+		token.type = EPGNToken::Comment;
+		token.text = ReadUntil('}');
+		return true;
+
+	case ';':
+		m_offset++;
+		token.type = EPGNToken::Comment;
+		token.text = ReadUntil('\n');
+		return true;
+
+	case '$':
+		m_offset++;
+		ReadWhile(IsDigit);
+		token.type = EPGNToken::Annotation;
+		token.text = m_text.substr(start, m_offset - start);
+		return true;
+
+	case '!':
+	case '?':
+		token.type = EPGNToken::Annotation;
+		token.text = ReadWhile(IsSuffixAnnotation);
+		return true;
+
+	case '(':
+	case ')':
+	case '+':
+	case '#':
+	case '*':
+		m_offset++;
+		token.text = m_text.substr(start, 1);
+		token.type = c == '(' ? EPGNToken::VariationStart
+			: c == ')' ? EPGNToken::VariationEnd
+			: c == '+' ? EPGNToken::Check
+			: c == '#' ? EPGNToken::Mate
+			: EPGNToken::Result;
+		return true;
+
+	default:
+		break;
+	}
+
+	// The escape mechanism: a line starting with % is ignored //
+	if (c == '%' && (start == 0 || m_text[start - 1] == '\n'))
+	{
+		m_offset++;
+		token.type = EPGNToken::Comment;
+		token.text = ReadUntil('\n');
+	}
+	else if (IsDigit(c))
+	{
+		ReadNumber(token);
+	}
+	else if (IsLetter(c))
+	{
+		ReadMove(token);
+	}
+	else
+	{
+		m_offset++;
+		token.type = EPGNToken::Unknown;
+		token.text = m_text.substr(start, 1);
+	}
+	return true;
+}
+
+std::size_t PGNLexer::GetOffset() const
+{
+	return m_offset;
+}
+
+std::string PGNLexer::Unescape(std::string_view value)
+{
+	std::string unescaped;
+	unescaped.reserve(value.size());
+
+	for (std::size_t i = 0; i < value.size(); i++)
+	{
+		if (value[i] == '\\' && i + 1 < value.size())
+			i++;
+		unescaped += value[i];
+	}
+	return unescaped;
+}
+
+void PGNLexer::SkipWhitespace()
+{
+	while (m_offset < m_text.size() && IsWhitespace(m_text[m_offset]))
+		m_offset++;
+}
+
+std::string_view PGNLexer::ReadWhile(bool (*predicate)(char))
+{
+	std::size_t start = m_offset;
+	while (m_offset < m_text.size() && predicate(m_text[m_offset]))
+		m_offset++;
+
+	return m_text.substr(start, m_offset - start);
+}
+
+std::string_view PGNLexer::ReadUntil(char end)
+{
+	// The text ends an unterminated token //
+	std::size_t start = m_offset;
+	std::size_t endOffset = m_text.find(end, start);
+	if (endOffset == std::string_view::npos)
+	{
+		m_offset = m_text.size();
+		return m_text.substr(start);
+	}
+
+	m_offset = endOffset + 1;
+	return m_text.substr(start, endOffset - start);
+}
+
+void PGNLexer::ReadTagPair(PGNToken& token)
+{
+	m_offset++;
+	SkipWhitespace();
+
+	token.type = EPGNToken::TagPair;
+	token.text = ReadWhile(IsTagNameCharacter);
+
+	SkipWhitespace();
+	if (m_offset < m_text.size() && m_text[m_offset] == '"')
+	{
+		std::size_t start = ++m_offset;
+		while (m_offset < m_text.size() && m_text[m_offset] != '"')
+		{
+			m_offset += m_text[m_offset] == '\\' ? 2 : 1;
+		}
+		m_offset = std::min(m_offset, m_text.size());
+
+		token.value = m_text.substr(start, m_offset - start);
+		m_offset = std::min(m_offset + 1, m_text.size());
+	}
+
+	ReadUntil(']');
+}
+
+void PGNLexer::ReadNumber(PGNToken& token)
+{
+	std::size_t start = m_offset;
+	token.text = ReadWhile(IsDigit);
+
+	if (m_offset < m_text.size() && m_text[m_offset] == '.')
+	{
+		while (m_offset < m_text.size() && m_text[m_offset] == '.')
+			m_offset++;
+
+		token.type = EPGNToken::MoveNumber;
+		return;
+	}
+
+	ReadWhile(IsNumberCharacter);
+	token.text = m_text.substr(start, m_offset - start);
+
+	if (token.text == "1-0" || token.text == "0-1" || token.text == "1/2-1/2")
+		token.type = EPGNToken::Result;
+	else if (token.text == "0-0" || token.text == "0-0-0")
+		token.type = EPGNToken::Move;
+	else
+		token.type = EPGNToken::Unknown;
+}
+
+void PGNLexer::ReadMove(PGNToken& token)
+{
+	token.type = EPGNToken::Move;
+	token.text = ReadWhile(IsMoveCharacter);
+}
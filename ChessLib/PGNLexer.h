@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using PGNTagList = std::vector<std::pair<std::string, std::string>>;
+
+enum class EPGNToken
+{
+	TagPair,		// [Name "Value"]
+	MoveNumber,		// 12. or 12...
+	Move,			// A move in algebraic notation without its check mark, e4, Nbxd7, e8=Q, O-O, 0-0
+	Check,			// +
+	Mate,			// #
+	Annotation,		// A numeric glyph $n or a suffix like !?
+	Comment,		// {...}, ; to the end of the line or a line starting with %
+	VariationStart,	// (
+	VariationEnd,	// )
+	Result,			// 1-0, 0-1, 1/2-1/2 or *
+	Unknown			// Anything else, one character at a time
+};
+
+struct PGNToken
+{
+	EPGNToken type;
+	std::string_view text;	// The token without its delimiters: the move, the comment inside the braces, the tag name
+	std::string_view value;	// The value of a tag pair between the quotes, escaped quotes are kept escaped
+};
+
+// Splits PGN text into tokens in a single pass, without copying: every token is a slice of the text,
+// which has to outlive the tokens
+class PGNLexer
+{
+public:
+	explicit PGNLexer(std::string_view text);
+
+	// Returns false at the end of the text //
+	bool Next(PGNToken& token);
+
+	// Where the next token starts looking, in characters from the start of the text //
+	std::size_t GetOffset() const;
+
+	// Copies a tag value without its escaping backslashes //
+	static std::string Unescape(std::string_view value);
+
+private:
+	void SkipWhitespace();
+	std::string_view ReadWhile(bool (*predicate)(char));
+	std::string_view ReadUntil(char end);
+
+	void ReadTagPair(PGNToken& token);
+	void ReadNumber(PGNToken& token);
+	void ReadMove(PGNToken& token);
+
+private:
+	std::string_view m_text;
+	std::size_t m_offset;
+};
@@ -1,8 +1,24 @@
 #include "PGNReader.h"
+#include "MappedFile.h"
 
-#include <sstream>
-#include <fstream>
-#include <regex>
+// ---		Local Static Functions													--- //
+
+// ChessGame reads moves without capture marks and writes castles with zeros //
+static std::string ToGameMove(std::string_view move)
+{
+	std::string gameMove;
+	gameMove.reserve(move.size());
+
+	for (char c : move)
+	{
+		if (c == 'x')
+			continue;
+		gameMove += c == 'O' ? '0' : c;
+	}
+	return gameMove;
+}
+
+// ------------------------------------------------------------------------------------ //
 
 PGNReader::PGNReader()
 {
@@ -10,32 +26,45 @@ PGNReader::PGNReader()
 
 bool PGNReader::LoadFromFile(const std::string& fileName)
 {
-	std::ifstream fileStream(fileName);
-
-	if (!fileStream.is_open())
+	// The lexer works on the mapped bytes, only the moves are copied //
+	MappedFile file;
+	if (!file.Open(fileName))
 		return false;
 
-	std::stringstream buffer;
-	buffer << fileStream.rdbuf();
-	fileStream.close();
-
-	return LoadFromString(buffer.str());
+	return LoadFromString(file.GetText());
 }
 
-bool PGNReader::LoadFromString(const std::string& str)
+bool PGNReader::LoadFromString(std::string_view str)
 {
-	std::string move;
+	PGNLexer lexer(str);
+	PGNToken token;
 
-	for (char c : str)
+	// Moves of variations are not played, the game ends at its result //
+	int variationDepth = 0;
+	while (lexer.Next(token))
 	{
-		if (c != ' ')
-			move += c;
-		else
+		switch (token.type)
 		{
-			move = std::regex_replace(move, std::regex("(\\b\\d+\\.\\s*)|\\s+|[+#x*]|1/2-1/2"), "");
-			if (!move.empty())
-				m_moves.push_back(move);
-			move.clear();
+		case EPGNToken::TagPair:
+			m_tags.emplace_back(std::string(token.text), PGNLexer::Unescape(token.value));
+			break;
+		case EPGNToken::VariationStart:
+			variationDepth++;
+			break;
+		case EPGNToken::VariationEnd:
+			if (variationDepth > 0)
+				variationDepth--;
+			break;
+		case EPGNToken::Move:
+			if (variationDepth == 0)
+				m_moves.push_back(ToGameMove(token.text));
+			break;
+		case EPGNToken::Result:
+			if (variationDepth == 0)
+				return true;
+			break;
+		default:
+			break;
 		}
 	}
 
@@ -46,3 +75,8 @@ const StringMoveList& PGNReader::GetMoves() const
 {
 	return m_moves;
 }
+
+const PGNTagList& PGNReader::GetTags() const
+{
+	return m_tags;
+}
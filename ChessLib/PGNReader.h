@@ -1,7 +1,10 @@
 #pragma once
 
+#include "PGNLexer.h"
+
 #include <vector>
 #include <string>
+#include <string_view>
 
 using StringMoveList = std::vector<std::string>;
 
@@ -13,13 +16,15 @@ public:
 	PGNReader();
 
 	bool LoadFromFile(const std::string& fileName);
-	bool LoadFromString(const std::string& str);
+	bool LoadFromString(std::string_view str);
 
 	const StringMoveList& GetMoves() const;
+	const PGNTagList& GetTags() const;
 
 private:
 
 	StringMoveList m_moves;
+	PGNTagList m_tags;
 };
 
 
@@ -0,0 +1,82 @@
+#include "Perft.h"
+
+static const std::string TABLE_COLUMNS("abcdefgh");
+static const std::string TABLE_ROWS("87654321");
+
+Perft::Perft(const CharBoard& board, EColor turn, CastleValues castle, int enPassantSquare)
+	: m_position(board, turn, castle, enPassantSquare)
+{
+}
+
+std::uint64_t Perft::Run(int depth) const
+{
+	BitboardPosition position = m_position;
+	return Count(position, depth);
+}
+
+PerftDivideList Perft::Divide(int depth) const
+{
+	PerftDivideList result;
+
+	BitboardPosition position = m_position;
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	for (const auto& move : moves)
+	{
+		UndoInfo undo = position.MakeMove(move);
+		result.emplace_back(MoveToString(move), depth > 1 ? Count(position, depth - 1) : 1);
+		position.UnmakeMove(undo);
+	}
+	return result;
+}
+
+std::string Perft::MoveToString(const Move& move)
+{
+	std::string str;
+	str += TABLE_COLUMNS[move.GetFrom() % 8];
+	str += TABLE_ROWS[move.GetFrom() / 8];
+	str += TABLE_COLUMNS[move.GetTo() % 8];
+	str += TABLE_ROWS[move.GetTo() / 8];
+
+	switch (move.GetPromotion())
+	{
+	case EType::Queen:
+		str += 'q';
+		break;
+	case EType::Rook:
+		str += 'r';
+		break;
+	case EType::Bishop:
+		str += 'b';
+		break;
+	case EType::Horse:
+		str += 'n';
+		break;
+	default:
+		break;
+	}
+	return str;
+}
+
+std::uint64_t Perft::Count(BitboardPosition& position, int depth)
+{
+	if (depth == 0)
+		return 1;
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	if (depth == 1)
+		return moves.size();
+
+	std::uint64_t nodes = 0;
+	for (const auto& move : moves)
+	{
+		UndoInfo undo = position.MakeMove(move);
+		nodes += Count(position, depth - 1);
+		position.UnmakeMove(undo);
+	}
+	return nodes;
+}
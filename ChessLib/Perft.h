@@ -0,0 +1,27 @@
+#pragma once
+
+#include "BitboardPosition.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using PerftDivideList = std::vector<std::pair<std::string, std::uint64_t>>;
+
+// Counts the leaf nodes of the legal move tree, used to verify and time move generation.
+class Perft
+{
+public:
+	Perft(const CharBoard& board, EColor turn = EColor::White, CastleValues castle = { true, true, true, true }, int enPassantSquare = -1);
+
+	std::uint64_t Run(int depth) const;
+	PerftDivideList Divide(int depth) const;
+
+	static std::string MoveToString(const Move& move);
+
+private:
+	static std::uint64_t Count(BitboardPosition& position, int depth);
+
+	BitboardPosition m_position;
+};
@@ -1,31 +1,37 @@
 #include "Piece.h"
 
-#include "Bishop.h"
-#include "Horse.h"
-#include "King.h"
-#include "Pawn.h"
-#include "Queen.h"
-#include "Rook.h"
-
 #include <cctype>
 
-PiecePtr Piece::Produce(EType type, EColor color)
+// ---		Local Static Functions													--- //
+
+static const std::shared_ptr<Piece>& GetSharedPiece(EType type, EColor color)
 {
-	switch (type)
+	// Created on first use and kept for the whole program, indexed by EColor and EType //
+	static const std::array<std::array<std::shared_ptr<Piece>, 6>, 2> pieces = []()
 	{
-	case EType::Rook:
-		return std::make_shared<Rook>(color);
-	case EType::Horse:
-		return std::make_shared<Horse>(color);
-	case EType::King:
-		return std::make_shared<King>(color);
-	case EType::Queen:
-		return std::make_shared<Queen>(color);
-	case EType::Bishop:
-		return std::make_shared<Bishop>(color);
-	case EType::Pawn:
-		return std::make_shared<Pawn>(color);
-	}
+		std::array<std::array<std::shared_ptr<Piece>, 6>, 2> result;
+		for (int color = 0; color < 2; color++)
+			for (int type = 0; type < 6; type++)
+				result[color][type] = std::make_shared<Piece>((EColor)color, (EType)type);
+		return result;
+	}();
+
+	return pieces[(int)color][(int)type];
+}
+
+// ------------------------------------------------------------------------------------ //
+
+PiecePtr Piece::Produce(EType type, EColor color)
+{
+	return GetSharedPiece(type, color).get();
+}
+
+IPiecePtr Piece::ToIPiecePtr(PiecePtr piece)
+{
+	if (!piece)
+		return nullptr;
+
+	return GetSharedPiece(piece->GetType(), piece->GetColor());
 }
 
 Piece::Piece(EColor color, EType name)
@@ -93,52 +99,3 @@ char Piece::ToLetter() const
 	}
 	return ' ';
 }
-
-PositionList Piece::GetFinalPositionsFromMovementArray(const std::array<Position, 8>& possibleMovements,
-	std::function<PiecePtr(Position)> GetPieceFromBoard) const
-{
-	PositionList finalPositions;
-
-	for (auto toCheckPosition : possibleMovements)
-	{
-		if (toCheckPosition.row < 0 || toCheckPosition.row > 7 ||
-			toCheckPosition.col < 0 || toCheckPosition.col > 7)
-		{
-			continue;
-		}
-		if (GetPieceFromBoard(toCheckPosition))
-		{
-			if (GetPieceFromBoard(toCheckPosition)->GetColor() != m_color)
-			{
-				finalPositions.push_back(toCheckPosition);
-			}
-			continue;
-		}
-		finalPositions.push_back(toCheckPosition);
-	}
-
-	return finalPositions;
-}
-
-void Piece::AddFinalPositionsByDirections(const Position& currentPos, Position movingWay, std::function<PiecePtr(Position)> GetPieceFromBoard, PositionList& finalPositions) const
-{
-	Position limit;
-	limit.row = movingWay.row < 0 ? -1 : 8;
-	limit.col = movingWay.col < 0 ? -1 : 8;
-
-	for (int i = currentPos.row + movingWay.row, j = currentPos.col + movingWay.col
-		;	 i != limit.row && j != limit.col
-		;	 i += movingWay.row, j += movingWay.col)
-	{
-		Position toCheckPosition(i, j);
-		if (GetPieceFromBoard(toCheckPosition))
-		{
-			if (GetPieceFromBoard(toCheckPosition)->GetColor() != m_color)
-			{
-				finalPositions.push_back(toCheckPosition);
-			}
-			break;
-		}
-		finalPositions.push_back(toCheckPosition);
-	}
-}
\ No newline at end of file
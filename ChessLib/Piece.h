@@ -2,13 +2,17 @@
 
 #include "IPiece.h"
 
-using PiecePtr = std::shared_ptr<class Piece>;
+// Pieces hold no state besides color and type, so the 12 of them are shared by
+// every board and a board is a plain array of pointers, copied without allocations
+using PiecePtr = const class Piece*;
 using PieceList = std::vector<PiecePtr>;
+using ArrayBoard = std::array<std::array<PiecePtr, 8>, 8>;
 
 class Piece : public IPiece
 {
 public:
 	static PiecePtr Produce(EType type, EColor color);
+	static IPiecePtr ToIPiecePtr(PiecePtr piece);
 
 	Piece(EColor color, EType name);
 
@@ -21,14 +25,7 @@ public:
 
 	char ToLetter() const;
 
-	virtual PositionList GetPattern(Position currentPos, std::function<PiecePtr(Position)> GetPieceFromBoard) const = 0;
-
 protected:
-	PositionList GetFinalPositionsFromMovementArray(const std::array<Position, 8>& possibleMovements,
-		std::function<PiecePtr(Position)> GetPieceFromBoard) const;
-	void AddFinalPositionsByDirections(const Position& currentPos, Position movingWay, 
-		std::function<PiecePtr(Position)> GetPieceFromBoard, PositionList& finalPositions) const;
-
 	EColor m_color;
 	EType m_type;
-};
\ No newline at end of file
+};
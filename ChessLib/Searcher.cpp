@@ -0,0 +1,389 @@
+#include "Searcher.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+// ---		Local Static Functions													--- //
+
+// History scores are halved once one of them passes this //
+static const int MAX_HISTORY = 50000;
+
+// What the position may still gain beyond the captured piece, for delta pruning in the quiescence search //
+static const int DELTA_MARGIN = 200;
+
+static int CountLegalMoves(const BitboardPosition& position)
+{
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+	return moves.size();
+}
+
+// ------------------------------------------------------------------------------------ //
+
+Searcher::Searcher(const BitboardPosition& position, const std::vector<std::uint64_t>& previousKeys,
+	const SearchLimits& limits, const std::atomic_bool& stop, TranspositionTable& table,
+	HistoryTable& history, const Nnue::Network* network /*= nullptr*/, int threadIndex /*= 0*/)
+	: m_position(position)
+	, m_keys(previousKeys)
+	, m_limits(limits)
+	, m_stop(stop)
+	, m_table(table)
+	, m_history(history)
+	, m_threadIndex(threadIndex)
+	, m_timeManager(limits, CountLegalMoves(position))
+	, m_stopped(false)
+	, m_nodes(0)
+	, m_depth(0)
+	, m_score(0)
+{
+	if (network)
+	{
+		m_accumulator = std::make_unique<Nnue::Accumulator>(*network);
+		m_position.SetAccumulator(m_accumulator.get());
+	}
+
+	if (m_keys.empty() || m_keys.back() != m_position.GetKey())
+	{
+		m_keys.push_back(m_position.GetKey());
+	}
+
+	for (auto& killers : m_killers)
+		killers.fill(Move());
+	for (auto& counterMoves : m_counterMoves)
+		counterMoves.fill(Move());
+}
+
+void Searcher::Run()
+{
+	m_timeManager.Start();
+
+	int maxDepth = m_limits.depth > 0 ? std::min(m_limits.depth, MAX_PLY - 1) : MAX_PLY - 1;
+
+	// Half of the helpers start one ply deeper, so the threads do not all search the same depth //
+	int startDepth = std::min(1 + m_threadIndex % 2, maxDepth);
+
+	for (int depth = startDepth; depth <= maxDepth; depth++)
+	{
+		int score = SearchNode(depth, 0, -INFINITE_SCORE, INFINITE_SCORE);
+		if (m_stopped)
+			break;
+
+		m_depth = depth;
+		m_score = score;
+		m_principalVariation.assign(m_pvTable[0].begin(), m_pvTable[0].begin() + m_pvLength[0]);
+
+		// Nothing is pruned, so a mate found within the depth can not get any shorter //
+		if (IChessEngine::MATE_SCORE - std::abs(score) <= depth)
+			break;
+
+		// Only the main searcher plans the time, the helpers stop with it //
+		if (m_threadIndex == 0 && m_timeManager.ShouldStopIterating(GetBestMove(), score))
+			break;
+	}
+}
+
+Move Searcher::GetBestMove() const
+{
+	return m_principalVariation.empty() ? Move() : m_principalVariation.front();
+}
+
+int Searcher::GetScore() const
+{
+	return m_score;
+}
+
+int Searcher::GetDepth() const
+{
+	return m_depth;
+}
+
+std::uint64_t Searcher::GetNodes() const
+{
+	return m_nodes;
+}
+
+const MoveLine& Searcher::GetPrincipalVariation() const
+{
+	return m_principalVariation;
+}
+
+int Searcher::SearchNode(int depth, int ply, int alpha, int beta)
+{
+	m_pvLength[ply] = ply;
+	m_nodes++;
+
+	if (ShouldStop())
+		return 0;
+
+	if (ply > 0 && IsRepetition())
+		return 0;
+
+	if (ply >= MAX_PLY - 1)
+		return m_position.Evaluate();
+
+	if (depth == 0)
+		return Quiescence(ply, alpha, beta);
+
+	// Outside the principal variation a deep enough stored result answers the node //
+	bool pvNode = beta - alpha > 1;
+	Move hashMove = Move();
+
+	TranspositionData entry;
+	if (m_table.Probe(m_position.GetKey(), entry))
+	{
+		hashMove = entry.move;
+
+		int score = ScoreFromTable(entry.score, ply);
+		if (!pvNode && entry.depth >= depth
+			&& (entry.bound == EBound::Exact
+				|| (entry.bound == EBound::Lower && score >= beta)
+				|| (entry.bound == EBound::Upper && score <= alpha)))
+		{
+			return score;
+		}
+	}
+
+	// The best move of the previous iteration is searched first, elsewhere the stored one //
+	Move pvMove = ply == 0 && m_depth > 0 ? GetBestMove() : hashMove;
+
+	Move previousMove = ply > 0 ? m_playedMoves[ply - 1] : Move();
+	Move counterMove = m_counterMoves[previousMove.GetFrom()][previousMove.GetTo()];
+
+	MovePicker picker(m_position, pvMove, m_killers[ply], counterMove, m_history);
+
+	int originalAlpha = alpha;
+	int bestScore = -INFINITE_SCORE;
+	Move bestMove = Move();
+	int moveCount = 0;
+
+	Move move;
+	while (picker.Next(move))
+	{
+		moveCount++;
+		m_playedMoves[ply] = move;
+
+		UndoInfo undo = m_position.MakeMove(move);
+		m_keys.push_back(m_position.GetKey());
+
+		// Principal variation search: once a move raised alpha, the others only have to be proven worse //
+		int score;
+		if (moveCount == 1)
+		{
+			score = -SearchNode(depth - 1, ply + 1, -beta, -alpha);
+		}
+		else
+		{
+			score = -SearchNode(depth - 1, ply + 1, -alpha - 1, -alpha);
+			if (!m_stopped && score > alpha && score < beta)
+				score = -SearchNode(depth - 1, ply + 1, -beta, -alpha);
+		}
+
+		m_keys.pop_back();
+		m_position.UnmakeMove(undo);
+
+		if (m_stopped)
+			return 0;
+
+		if (score > bestScore)
+		{
+			bestScore = score;
+
+			if (score > alpha)
+			{
+				alpha = score;
+				bestMove = move;
+
+				m_pvTable[ply][ply] = move;
+				for (int next = ply + 1; next < m_pvLength[ply + 1]; next++)
+				{
+					m_pvTable[ply][next] = m_pvTable[ply + 1][next];
+				}
+				m_pvLength[ply] = std::max(m_pvLength[ply + 1], ply + 1);
+
+				if (alpha >= beta)
+				{
+					if (MovePicker::IsQuiet(move))
+						UpdateQuietStats(move, depth, ply);
+					break;
+				}
+			}
+		}
+	}
+
+	if (moveCount == 0)
+		return m_position.IsInCheck(m_position.GetTurn()) ? ply - IChessEngine::MATE_SCORE : 0;
+
+	EBound bound = bestScore >= beta ? EBound::Lower : (alpha > originalAlpha ? EBound::Exact : EBound::Upper);
+	m_table.Store(m_position.GetKey(), bestMove, ScoreToTable(bestScore, ply), depth, bound);
+
+	return bestScore;
+}
+
+// Searches captures until the position is quiet, so a leaf is never scored in the middle of an exchange //
+int Searcher::Quiescence(int ply, int alpha, int beta)
+{
+	m_pvLength[ply] = ply;
+	m_nodes++;
+
+	if (ShouldStop())
+		return 0;
+
+	if (ply >= MAX_PLY - 1)
+		return m_position.Evaluate();
+
+	// Quiescence results are stored with depth 0, so any stored result answers the node //
+	TranspositionData entry;
+	if (m_table.Probe(m_position.GetKey(), entry))
+	{
+		int score = ScoreFromTable(entry.score, ply);
+		if (entry.bound == EBound::Exact
+			|| (entry.bound == EBound::Lower && score >= beta)
+			|| (entry.bound == EBound::Upper && score <= alpha))
+		{
+			return score;
+		}
+	}
+
+	// In check every evasion is searched, otherwise the player may stand pat with the static score //
+	bool inCheck = m_position.IsInCheck(m_position.GetTurn());
+	int standPat = -INFINITE_SCORE;
+	if (!inCheck)
+	{
+		standPat = m_position.Evaluate();
+		if (standPat >= beta)
+			return standPat;
+		alpha = std::max(alpha, standPat);
+	}
+
+	// Losing captures are never picked (SEE pruning) //
+	MovePicker picker(m_position, m_history);
+
+	int originalAlpha = alpha;
+	int bestScore = standPat;
+	Move bestMove = Move();
+	int moveCount = 0;
+
+	Move move;
+	while (picker.Next(move))
+	{
+		moveCount++;
+
+		// Delta pruning: skip captures that cannot raise alpha even winning the piece for free //
+		if (!inCheck && move.GetPromotion() == EType::Pawn)
+		{
+			EType victim = move.GetFlag() == EMoveFlag::EnPassant ? EType::Pawn : m_position.GetType(move.GetTo());
+			if (standPat + Evaluation::PieceValues[(int)victim] + DELTA_MARGIN <= alpha)
+				continue;
+		}
+
+		UndoInfo undo = m_position.MakeMove(move);
+		int score = -Quiescence(ply + 1, -beta, -alpha);
+		m_position.UnmakeMove(undo);
+
+		if (m_stopped)
+			return 0;
+
+		if (score > bestScore)
+		{
+			bestScore = score;
+			if (score > alpha)
+			{
+				alpha = score;
+				bestMove = move;
+				if (alpha >= beta)
+					break;
+			}
+		}
+	}
+
+	if (inCheck && moveCount == 0)
+		return ply - IChessEngine::MATE_SCORE;
+
+	EBound bound = bestScore >= beta ? EBound::Lower : (alpha > originalAlpha ? EBound::Exact : EBound::Upper);
+	m_table.Store(m_position.GetKey(), bestMove, ScoreToTable(bestScore, ply), 0, bound);
+
+	return bestScore;
+}
+
+void Searcher::AgeHistory(HistoryTable& history)
+{
+	for (auto& colorHistory : history)
+		for (auto& fromHistory : colorHistory)
+			for (int& score : fromHistory)
+				score /= 2;
+}
+
+void Searcher::UpdateQuietStats(Move move, int depth, int ply)
+{
+	if (m_killers[ply][0] != move)
+	{
+		m_killers[ply][1] = m_killers[ply][0];
+		m_killers[ply][0] = move;
+	}
+
+	if (ply > 0)
+	{
+		Move previousMove = m_playedMoves[ply - 1];
+		m_counterMoves[previousMove.GetFrom()][previousMove.GetTo()] = move;
+	}
+
+	auto& colorHistory = m_history[(int)m_position.GetTurn()];
+
+	int& score = colorHistory[move.GetFrom()][move.GetTo()];
+	score += depth * depth;
+
+	if (score > MAX_HISTORY)
+	{
+		for (auto& fromHistory : colorHistory)
+			for (int& value : fromHistory)
+				value /= 2;
+	}
+}
+
+bool Searcher::IsRepetition() const
+{
+	// Only positions with the same player to move can be equal //
+	std::uint64_t key = m_keys.back();
+	for (int i = (int)m_keys.size() - 3; i >= 0; i -= 2)
+	{
+		if (m_keys[i] == key)
+			return true;
+	}
+	return false;
+}
+
+// Mate scores are stored as distances from the node, so they stay right when the node is reached by another path //
+int Searcher::ScoreToTable(int score, int ply)
+{
+	if (score >= IChessEngine::MATE_SCORE - MAX_PLY)
+		return score + ply;
+	if (score <= MAX_PLY - IChessEngine::MATE_SCORE)
+		return score - ply;
+	return score;
+}
+
+int Searcher::ScoreFromTable(int score, int ply)
+{
+	if (score >= IChessEngine::MATE_SCORE - MAX_PLY)
+		return score - ply;
+	if (score <= MAX_PLY - IChessEngine::MATE_SCORE)
+		return score + ply;
+	return score;
+}
+
+bool Searcher::ShouldStop()
+{
+	// The main searcher always completes its first iteration, so there is a move to return //
+	if (m_stopped || (m_depth == 0 && m_threadIndex == 0))
+		return m_stopped;
+
+	if (m_stop || (m_limits.nodes && m_nodes >= m_limits.nodes))
+	{
+		m_stopped = true;
+	}
+	else if (m_timeManager.HasHardLimit() && (m_nodes & 1023) == 0)
+	{
+		m_stopped = m_timeManager.IsHardLimitReached();
+	}
+	return m_stopped;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "BitboardPosition.h"
+#include "MovePicker.h"
+#include "Nnue.h"
+#include "IChessEngine.h"
+#include "TranspositionTable.h"
+#include "TimeManager.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using MoveLine = std::vector<Move>;
+
+// Runs the iterative deepening search of one position on its own copy of the board.
+// The result is the one of the last iteration that was searched completely.
+// Several searchers of the same position share the transposition table (Lazy SMP):
+// the helpers (thread index above 0) fill it with results the main searcher reuses.
+class Searcher
+{
+public:
+	static const int MAX_PLY = 128;
+	static const int INFINITE_SCORE = IChessEngine::MATE_SCORE + 1;
+
+	Searcher(const BitboardPosition& position, const std::vector<std::uint64_t>& previousKeys,
+		const SearchLimits& limits, const std::atomic_bool& stop, TranspositionTable& table,
+		HistoryTable& history, const Nnue::Network* network = nullptr, int threadIndex = 0);
+
+	void Run();
+
+	Move GetBestMove() const;
+	int GetScore() const;
+	int GetDepth() const;
+	std::uint64_t GetNodes() const;
+	const MoveLine& GetPrincipalVariation() const;
+
+	static void AgeHistory(HistoryTable& history);
+
+private:
+	int SearchNode(int depth, int ply, int alpha, int beta);
+	int Quiescence(int ply, int alpha, int beta);
+	bool IsRepetition() const;
+	bool ShouldStop();
+
+	void UpdateQuietStats(Move move, int depth, int ply);
+
+	static int ScoreToTable(int score, int ply);
+	static int ScoreFromTable(int score, int ply);
+
+private:
+	BitboardPosition m_position;
+	std::unique_ptr<Nnue::Accumulator> m_accumulator;	// Attached to m_position when searching with a network
+	std::vector<std::uint64_t> m_keys;	// Keys of the game since the last capture or pawn move, then of the searched line
+	SearchLimits m_limits;
+	const std::atomic_bool& m_stop;
+	TranspositionTable& m_table;
+	HistoryTable& m_history;
+	int m_threadIndex;
+	TimeManager m_timeManager;
+	bool m_stopped;
+
+	std::uint64_t m_nodes;
+	int m_depth;
+	int m_score;
+	MoveLine m_principalVariation;
+
+	// Quiet moves that caused a cutoff: two per ply, and one answer to every move indexed by its squares //
+	std::array<std::array<Move, 2>, MAX_PLY> m_killers;
+	std::array<std::array<Move, 64>, 64> m_counterMoves;
+	std::array<Move, MAX_PLY> m_playedMoves;	// The move made at each ply of the searched line
+
+	// Row ply holds the best line found from that ply, its moves start at index ply //
+	std::array<std::array<Move, MAX_PLY>, MAX_PLY> m_pvTable;
+	std::array<int, MAX_PLY> m_pvLength;
+};
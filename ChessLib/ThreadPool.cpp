@@ -0,0 +1,94 @@
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool()
+	: m_taskCount(0)
+	, m_running(0)
+	, m_quit(false)
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+	StopThreads();
+}
+
+void ThreadPool::Resize(int threadCount)
+{
+	if (threadCount == GetSize())
+		return;
+
+	StopThreads();
+
+	m_quit = false;
+	for (int i = 0; i < threadCount; i++)
+	{
+		m_threads.emplace_back(&ThreadPool::WorkerLoop, this, i, m_taskCount);
+	}
+}
+
+int ThreadPool::GetSize() const
+{
+	return (int)m_threads.size();
+}
+
+void ThreadPool::Start(std::function<void(int)> task)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	m_doneCV.wait(lock, [this]() { return m_running == 0; });
+
+	m_task = task;
+	m_running = GetSize();
+	m_taskCount++;
+
+	m_startCV.notify_all();
+}
+
+void ThreadPool::Wait()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	m_doneCV.wait(lock, [this]() { return m_running == 0; });
+}
+
+void ThreadPool::WorkerLoop(int index, std::uint64_t lastTask)
+{
+	while (true)
+	{
+		std::function<void(int)> task;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			m_startCV.wait(lock, [this, lastTask]() { return m_quit || m_taskCount != lastTask; });
+			if (m_quit)
+				return;
+
+			lastTask = m_taskCount;
+			task = m_task;
+		}
+
+		task(index);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_running--;
+		}
+		m_doneCV.notify_all();
+	}
+}
+
+void ThreadPool::StopThreads()
+{
+	Wait();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+	m_startCV.notify_all();
+
+	for (auto& thread : m_threads)
+	{
+		thread.join();
+	}
+	m_threads.clear();
+}
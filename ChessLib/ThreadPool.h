@@ -0,0 +1,38 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Threads started once and woken for every task, so a search does not pay for creating them.
+// Every thread runs the same task with its own index; the caller waits for all of them.
+class ThreadPool
+{
+public:
+	ThreadPool();
+	~ThreadPool();
+
+	void Resize(int threadCount);
+	int GetSize() const;
+
+	void Start(std::function<void(int)> task);
+	void Wait();
+
+private:
+	void WorkerLoop(int index, std::uint64_t lastTask);
+	void StopThreads();
+
+private:
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_startCV;
+	std::condition_variable m_doneCV;
+
+	std::function<void(int)> m_task;
+	std::uint64_t m_taskCount;	// Tells the threads a new task was started
+	int m_running;
+	bool m_quit;
+};
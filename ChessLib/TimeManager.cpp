@@ -0,0 +1,105 @@
+#include "TimeManager.h"
+
+#include <algorithm>
+
+// ---		Local Static Functions													--- //
+
+// Kept on the clock for the time the move takes to reach the game //
+static const int MOVE_OVERHEAD = 50;
+
+// The moves the rest of the game is planned for when there is no time control to reach //
+static const int DEFAULT_MOVES_TO_GO = 30;
+
+// A score this much below the one of the previous iteration gets the search more time //
+static const int SCORE_DROP = 30;
+
+static const int MAX_STABILITY = 4;
+
+// ------------------------------------------------------------------------------------ //
+
+TimeManager::TimeManager(const SearchLimits& limits, int legalMoveCount)
+	: m_softLimit(0)
+	, m_hardLimit(0)
+	, m_bestMove()
+	, m_stability(0)
+	, m_previousScore(0)
+	, m_scoreDropped(false)
+	, m_iterations(0)
+{
+	if (limits.remainingTime > 0)
+	{
+		int available = std::max(limits.remainingTime - MOVE_OVERHEAD, 1);
+		int movesToGo = limits.movesToGo > 0 ? std::min(limits.movesToGo, DEFAULT_MOVES_TO_GO) : DEFAULT_MOVES_TO_GO;
+
+		// Most of the increment is spent right away, it comes back after the move //
+		m_softLimit = available / movesToGo + limits.increment * 3 / 4;
+		m_hardLimit = std::max(std::min(m_softLimit * 4, available * 3 / 4), 1);
+		m_softLimit = std::max(std::min(m_softLimit, m_hardLimit), 1);
+	}
+
+	if (limits.time > 0)
+	{
+		m_hardLimit = m_hardLimit > 0 ? std::min(m_hardLimit, limits.time) : limits.time;
+		if (m_softLimit > 0)
+			m_softLimit = std::min(m_softLimit, m_hardLimit);
+	}
+
+	m_forcedMove = m_hardLimit > 0 && legalMoveCount == 1;
+}
+
+void TimeManager::Start()
+{
+	m_startTime = std::chrono::steady_clock::now();
+}
+
+int TimeManager::GetElapsed() const
+{
+	return (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_startTime).count();
+}
+
+bool TimeManager::HasHardLimit() const
+{
+	return m_hardLimit > 0;
+}
+
+bool TimeManager::IsHardLimitReached() const
+{
+	return GetElapsed() >= m_hardLimit;
+}
+
+bool TimeManager::ShouldStopIterating(Move bestMove, int score)
+{
+	if (m_forcedMove)
+		return true;
+
+	if (m_iterations > 0)
+	{
+		m_stability = bestMove == m_bestMove ? std::min(m_stability + 1, MAX_STABILITY) : 0;
+		m_scoreDropped = score < m_previousScore - SCORE_DROP;
+	}
+	m_bestMove = bestMove;
+	m_previousScore = score;
+	m_iterations++;
+
+	if (m_softLimit == 0)
+		return false;
+
+	// The next iteration takes longer than all the previous ones, so it is not started if it can not finish //
+	int elapsed = GetElapsed();
+	return elapsed >= GetSoftLimit() || elapsed * 2 >= m_hardLimit;
+}
+
+int TimeManager::GetSoftLimit() const
+{
+	// From 125% while the best move changes down to 65% once it stayed the same for four iterations //
+	int percent = 125 - 15 * m_stability;
+	if (m_scoreDropped)
+		percent += 50;
+
+	return std::min(m_softLimit * percent / 100, m_hardLimit);
+}
+
+int TimeManager::GetHardLimit() const
+{
+	return m_hardLimit;
+}
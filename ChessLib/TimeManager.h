@@ -0,0 +1,46 @@
+#pragma once
+
+#include "IChessEngine.h"
+#include "Move.h"
+
+#include <chrono>
+
+// Plans the time of one search from its limits: a fixed time, or the clock of the player to move.
+// The hard limit stops the search anywhere and always leaves a margin on the clock.
+// The soft limit is checked between iterations and scaled by how the search goes:
+// a best move that stays the same stops early, a falling score gets more time.
+// A forced move is played after the first iteration.
+class TimeManager
+{
+public:
+	TimeManager(const SearchLimits& limits, int legalMoveCount);
+
+	void Start();
+
+	// Milliseconds since Start //
+	int GetElapsed() const;
+
+	bool HasHardLimit() const;
+	bool IsHardLimitReached() const;
+
+	// Takes the result of a complete iteration and tells if the next one is not worth starting //
+	bool ShouldStopIterating(Move bestMove, int score);
+
+	// In milliseconds, 0 when there is none //
+	int GetSoftLimit() const;
+	int GetHardLimit() const;
+
+private:
+	std::chrono::steady_clock::time_point m_startTime;
+
+	int m_softLimit;	// Before scaling
+	int m_hardLimit;
+	bool m_forcedMove;
+
+	// What the previous iterations found //
+	Move m_bestMove;
+	int m_stability;	// Iterations in a row with the same best move
+	int m_previousScore;
+	bool m_scoreDropped;
+	int m_iterations;
+};
@@ -0,0 +1,137 @@
+#include "TranspositionTable.h"
+
+#include <algorithm>
+
+// ---		Local Static Functions													--- //
+
+// Layout of the data: move in bits 0-15, score in bits 16-31, depth in bits 32-39,
+// bound in bits 40-41 and generation in bits 42-47
+
+static Move GetMove(std::uint64_t data)
+{
+	return Move::FromData((std::uint16_t)data);
+}
+
+static int GetScore(std::uint64_t data)
+{
+	return (std::int16_t)(data >> 16);
+}
+
+static int GetDepth(std::uint64_t data)
+{
+	return (std::uint8_t)(data >> 32);
+}
+
+static EBound GetBound(std::uint64_t data)
+{
+	return (EBound)((data >> 40) & 3);
+}
+
+static std::uint8_t GetGeneration(std::uint64_t data)
+{
+	return (data >> 42) & 63;
+}
+
+// ------------------------------------------------------------------------------------ //
+
+TranspositionTable::TranspositionTable(std::size_t megabytes /*= DEFAULT_SIZE_MB*/)
+	: m_mask(0)
+	, m_generation(0)
+{
+	Resize(megabytes);
+}
+
+void TranspositionTable::Resize(std::size_t megabytes)
+{
+	static_assert(sizeof(Entry) == 16, "An entry must take 16 bytes");
+
+	// Largest power of two that fits, at least one entry //
+	std::size_t count = 1;
+	while (count * 2 * sizeof(Entry) <= megabytes * 1024 * 1024)
+	{
+		count *= 2;
+	}
+
+	m_entries.reset(new Entry[count]);
+	m_mask = count - 1;
+	Clear();
+}
+
+void TranspositionTable::Clear()
+{
+	for (std::size_t i = 0; i <= m_mask; i++)
+	{
+		m_entries[i].keyXorData.store(0, std::memory_order_relaxed);
+		m_entries[i].data.store(0, std::memory_order_relaxed);
+	}
+	m_generation = 0;
+}
+
+void TranspositionTable::NewSearch()
+{
+	m_generation = (m_generation + 1) & 63;
+}
+
+bool TranspositionTable::Probe(std::uint64_t key, TranspositionData& data) const
+{
+	const Entry& entry = m_entries[key & m_mask];
+
+	std::uint64_t packed = entry.data.load(std::memory_order_relaxed);
+	if ((entry.keyXorData.load(std::memory_order_relaxed) ^ packed) != key || GetBound(packed) == EBound::None)
+		return false;
+
+	data.move = GetMove(packed);
+	data.score = GetScore(packed);
+	data.depth = GetDepth(packed);
+	data.bound = GetBound(packed);
+	return true;
+}
+
+void TranspositionTable::Store(std::uint64_t key, Move move, int score, int depth, EBound bound)
+{
+	Entry& entry = m_entries[key & m_mask];
+
+	std::uint64_t oldData = entry.data.load(std::memory_order_relaxed);
+	bool sameKey = (entry.keyXorData.load(std::memory_order_relaxed) ^ oldData) == key;
+
+	// Deeper results of the current search are kept, other positions and older searches are replaced //
+	if (sameKey && bound != EBound::Exact && GetGeneration(oldData) == m_generation && depth < GetDepth(oldData))
+		return;
+
+	// A result without a move keeps the move found earlier for the same position //
+	if (sameKey && move == Move())
+		move = GetMove(oldData);
+
+	std::uint64_t data = Pack(move, score, depth, bound, m_generation);
+	entry.keyXorData.store(key ^ data, std::memory_order_relaxed);
+	entry.data.store(data, std::memory_order_relaxed);
+}
+
+std::size_t TranspositionTable::GetEntryCount() const
+{
+	return m_mask + 1;
+}
+
+int TranspositionTable::GetHashfull() const
+{
+	// Permille of entries used by the current search, sampled on the first thousand //
+	std::size_t samples = std::min<std::size_t>(1000, m_mask + 1);
+	std::size_t used = 0;
+
+	for (std::size_t i = 0; i < samples; i++)
+	{
+		std::uint64_t data = m_entries[i].data.load(std::memory_order_relaxed);
+		if (GetBound(data) != EBound::None && GetGeneration(data) == m_generation)
+			used++;
+	}
+	return (int)(used * 1000 / samples);
+}
+
+std::uint64_t TranspositionTable::Pack(Move move, int score, int depth, EBound bound, std::uint8_t generation)
+{
+	return (std::uint64_t)move.GetData()
+		| ((std::uint64_t)(std::uint16_t)score << 16)
+		| ((std::uint64_t)(std::uint8_t)depth << 32)
+		| ((std::uint64_t)bound << 40)
+		| ((std::uint64_t)generation << 42);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Move.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+enum class EBound : std::uint8_t
+{
+	None,
+	Upper,	// The score is at most the stored one, no move raised alpha
+	Lower,	// The score is at least the stored one, the move caused a beta cutoff
+	Exact
+};
+
+struct TranspositionData
+{
+	Move move;
+	int score;
+	int depth;
+	EBound bound;
+};
+
+// Fixed-size hash table of search results shared by all the search threads.
+// Each entry takes 16 bytes: the data and the key xor the data. Two threads
+// writing the same entry at once leave a key that does not match, so a torn
+// entry reads as a miss and no lock is needed.
+class TranspositionTable
+{
+public:
+	static const std::size_t DEFAULT_SIZE_MB = 16;
+
+	TranspositionTable(std::size_t megabytes = DEFAULT_SIZE_MB);
+
+	void Resize(std::size_t megabytes);
+	void Clear();
+	void NewSearch();
+
+	bool Probe(std::uint64_t key, TranspositionData& data) const;
+	void Store(std::uint64_t key, Move move, int score, int depth, EBound bound);
+
+	std::size_t GetEntryCount() const;
+	int GetHashfull() const;
+
+private:
+	struct Entry
+	{
+		std::atomic<std::uint64_t> keyXorData;
+		std::atomic<std::uint64_t> data;
+	};
+
+	static std::uint64_t Pack(Move move, int score, int depth, EBound bound, std::uint8_t generation);
+
+private:
+	std::unique_ptr<Entry[]> m_entries;
+	std::size_t m_mask;			// Entry count minus one, the count is a power of two
+	std::uint8_t m_generation;	// Tells entries of older searches apart, so they are replaced first
+};
@@ -0,0 +1,44 @@
+#include "Zobrist.h"
+
+namespace Zobrist
+{
+	std::array<std::array<std::array<std::uint64_t, 64>, 6>, 2> Pieces;
+	std::array<std::array<std::uint64_t, 2>, 2> Castle;
+	std::array<std::uint64_t, 8> EnPassant;
+	std::uint64_t BlackToMove;
+}
+
+// ---		Local Static Functions													--- //
+
+// SplitMix64 //
+static std::uint64_t NextRandom(std::uint64_t& state)
+{
+	std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+static struct ZobristInitializer
+{
+	ZobristInitializer()
+	{
+		std::uint64_t state = 0x2545F4914F6CDD1Dull;
+
+		for (auto& colorKeys : Zobrist::Pieces)
+			for (auto& typeKeys : colorKeys)
+				for (auto& key : typeKeys)
+					key = NextRandom(state);
+
+		for (auto& colorKeys : Zobrist::Castle)
+			for (auto& key : colorKeys)
+				key = NextRandom(state);
+
+		for (auto& key : Zobrist::EnPassant)
+			key = NextRandom(state);
+
+		Zobrist::BlackToMove = NextRandom(state);
+	}
+} s_initializer;
+
+// ------------------------------------------------------------------------------------ //
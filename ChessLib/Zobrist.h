@@ -0,0 +1,15 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Random keys XOR-ed together into the 64-bit key of a position.
+// The generator has a fixed seed, so keys are the same on every run.
+
+namespace Zobrist
+{
+	extern std::array<std::array<std::array<std::uint64_t, 64>, 6>, 2> Pieces;	// indexed by EColor, EType and square
+	extern std::array<std::array<std::uint64_t, 2>, 2> Castle;					// indexed by EColor and ESide
+	extern std::array<std::uint64_t, 8> EnPassant;								// indexed by column
+	extern std::uint64_t BlackToMove;
+}
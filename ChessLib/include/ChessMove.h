@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Enums.h"
+#include "Position.h"
+
+#include <vector>
+
+/**
+ * @brief Represents a legal move of the player to move.
+ */
+struct ChessMove
+{
+    Position from;      ///< The position of the moving piece.
+    Position to;        ///< The position the piece moves to.
+    EMoveFlag flag;     ///< What the move does besides moving the piece.
+    EType promotion;    ///< The type the pawn is upgraded to, `EType::Pawn` if the move is not an upgrade.
+};
+
+using ChessMoveList = std::vector<ChessMove>;
@@ -41,6 +41,18 @@ enum class EType
     Pawn    ///< A pawn chess piece.
 };
 
+/**
+ * @brief Enumeration for specifying the kind of a chess move.
+ */
+enum class EMoveFlag
+{
+    Quiet,          ///< A move to an empty square.
+    Capture,        ///< A move that captures the piece on the final square.
+    DoublePawnPush, ///< A pawn moving two squares from its initial row.
+    EnPassant,      ///< A pawn capturing en passant.
+    Castle          ///< A king castling, the rook move is implied.
+};
+
 /**
  * @brief Enumeration for specifying the result of a chess game.
  */
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "ChessMove.h"
+#include "IChessGame.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using IChessEnginePtr = std::shared_ptr<class IChessEngine>;
+
+/**
+ * @brief Limits of a search. A limit left at 0 does not stop the search.
+ *
+ * With the clock of the player to move the engine plans its own time: it stops early when the best
+ * move stays the same, takes longer when the score drops, plays a forced move right away and always
+ * keeps a margin on the clock.
+ */
+struct SearchLimits
+{
+    int depth = 0;              ///< The deepest iteration to search, in plies.
+    std::uint64_t nodes = 0;    ///< The number of positions searched by the main thread after which the search stops.
+    int time = 0;               ///< The time after which the search stops, in milliseconds.
+    int remainingTime = 0;      ///< The time left on the clock of the player to move, in milliseconds.
+    int increment = 0;          ///< The time added to the clock after the move, in milliseconds.
+    int movesToGo = 0;          ///< The moves left until the next time control, 0 when the clock has to last the whole game.
+};
+
+/**
+ * @brief The result of a search, taken from the last iteration that was searched completely.
+ */
+struct SearchResult
+{
+    ChessMove bestMove;                 ///< The move the engine would play.
+    int score;                          ///< The score in centipawns for the player to move, see IChessEngine::MATE_SCORE.
+    int depth;                          ///< The depth of the last complete iteration.
+    std::uint64_t nodes;                ///< The number of positions visited by all the search threads.
+    ChessMoveList principalVariation;   ///< The expected continuation, starting with the best move.
+};
+
+/**
+ * @brief Interface for a computer opponent searching the positions of a chess game.
+ *
+ * The search runs iterative deepening until a limit is reached, so stopping it early still returns
+ * the result of the last complete iteration.
+ */
+class IChessEngine
+{
+public:
+    /**
+     * @brief The score of a position where the player to move gives mate right away.
+     *
+     * A mate in N plies scores `MATE_SCORE - N`, being mated in N plies scores `N - MATE_SCORE`.
+     */
+    static const int MATE_SCORE = 32000;
+
+    /**
+     * @brief Creates a new instance of a chess engine.
+     * @return A shared pointer to the created engine instance.
+     */
+    static IChessEnginePtr CreateEngine();
+
+    /**
+     * @brief Creates search limits from the clock of a game in timed mode.
+     *
+     * @param clock The timed mode of the game.
+     * @param color The player the engine moves for.
+     * @return Limits with the remaining time and increment of the player.
+     */
+    static SearchLimits GetClockLimits(const IChessGameTimedMode& clock, EColor color);
+
+    /**
+     * @brief Virtual destructor for the IChessEngine interface.
+     */
+    virtual ~IChessEngine() = default;
+
+    /**
+     * @brief Searches the current position of a game for the best move of the current player.
+     *
+     * The game is not changed and may not be changed while the search runs.
+     *
+     * @param game The status of a game created by ChessLib.
+     * @param limits When to stop the search; at least one iteration is always completed.
+     * @return The best move found, with its score and principal variation.
+     * @throws InvalidStateException If the current player has no legal move.
+     * @throws ChessException If the game was not created by ChessLib.
+     */
+    virtual SearchResult Search(const IChessGameStatus& game, const SearchLimits& limits) = 0;
+
+    /**
+     * @brief Stops the running search, which then returns as soon as possible. Can be called from any thread.
+     */
+    virtual void Stop() = 0;
+
+    /**
+     * @brief Resizes the table of positions kept between searches, which also clears it.
+     *
+     * The table keeps the largest power of two number of entries that fits in the size.
+     *
+     * @param megabytes The size of the table in megabytes (default is 16).
+     */
+    virtual void SetHashSize(int megabytes) = 0;
+
+    /**
+     * @brief Clears the table of positions, so the next search does not use earlier results.
+     */
+    virtual void ClearHash() = 0;
+
+    /**
+     * @brief Retrieves how full the table of positions is with results of the last search.
+     *
+     * @return The used part of the table, in permille.
+     */
+    virtual int GetHashfull() const = 0;
+
+    /**
+     * @brief Sets the number of threads searching together, all sharing the table of positions.
+     *
+     * The threads are started here and reused by every search. With one thread (the default) the
+     * search runs on the calling thread only, so the same searches always give the same results.
+     *
+     * @param count The number of threads, at least 1.
+     */
+    virtual void SetThreadCount(int count) = 0;
+
+    /**
+     * @brief Retrieves the number of threads searching together.
+     */
+    virtual int GetThreadCount() const = 0;
+
+    /**
+     * @brief Loads a quantized evaluation network, used by the next searches instead of the built-in evaluation.
+     *
+     * The network runs on the CPU with the widest instructions it supports (AVX2, SSE4.1 or none).
+     * `IChessGameStatus::Evaluate` keeps using the built-in evaluation.
+     *
+     * @param fileName The network file: 768 inputs for the pieces, 256 hidden units for each player and one output,
+     *                 with the weights stored as little-endian 16-bit integers.
+     * @return `true` if the network was loaded, otherwise `false` and the previous evaluation is kept.
+     */
+    virtual bool LoadNetwork(const std::string& fileName) = 0;
+
+    /**
+     * @brief Goes back to the built-in evaluation for the next searches.
+     */
+    virtual void UnloadNetwork() = 0;
+};
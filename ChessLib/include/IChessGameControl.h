@@ -50,6 +50,13 @@ public:
      */
     virtual void MakeMove(Position initialPos, Position finalPos, bool EnableNotification = true, EType upgradeType = EType::Pawn) = 0;
 
+    /**
+     * @brief Takes back the last move, restoring the board, the captured pieces and the move history.
+     *
+     * @throws InvalidStateException If there is no move to take back.
+     */
+    virtual void UndoMove() = 0;
+
     /**
      * @brief Upgrades a pawn to a specified piece type.
      *
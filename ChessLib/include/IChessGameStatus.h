@@ -1,6 +1,10 @@
 #pragma once
 
 #include "Enums.h"
+#include "ChessMove.h"
+#include "Move.h"
+
+#include <cstdint>
 
 /**
  * @brief Interface for retrieving various status and information about a chess game.
@@ -33,6 +37,65 @@ public:
      */
     virtual PositionList GetPossibleMoves(Position currentPos) const = 0;
 
+    /**
+     * @brief Fills a move list with the legal moves of the piece at the given position.
+     *
+     * Unlike the `PositionList` overload this does not allocate, and an upgrade move is listed once
+     * for every type the pawn can be upgraded to. The list is cleared first.
+     *
+     * @param currentPos The position of the piece for which to retrieve possible moves.
+     * @param moves The list receiving the moves, empty if the position holds no piece of the current player.
+     */
+    virtual void GetPossibleMoves(Position currentPos, FixedMoveList& moves) const = 0;
+
+    /**
+     * @brief Retrieves all the legal moves of the current player.
+     *
+     * The list is generated once per position and kept until the position changes, so repeated
+     * calls are cheap. An upgrade move is listed once for every type the pawn can be upgraded to.
+     * Several threads may call it at once while no move is made.
+     *
+     * @return The legal moves of the current player, valid until the next move.
+     */
+    virtual const ChessMoveList& GetAllPossibleMoves() const = 0;
+
+    /**
+     * @brief Checks if a position is attacked by the pieces of the given color.
+     *
+     * A position holding a piece of the same color counts as attacked when the piece is defended.
+     * The attacks are computed once per position and kept until the position changes.
+     * Several threads may call it at once while no move is made.
+     *
+     * @param pos The position to check.
+     * @param attackerColor The color of the attacking pieces.
+     * @return `true` if at least one piece of the given color attacks the position, otherwise `false`.
+     */
+    virtual bool IsAttacked(Position pos, EColor attackerColor) const = 0;
+
+    /**
+     * @brief Retrieves the positions of the pieces of the given color that attack a position.
+     *
+     * @param pos The attacked position.
+     * @param attackerColor The color of the attacking pieces.
+     * @return The positions of the attacking pieces, empty if the position is not attacked.
+     */
+    virtual PositionList GetAttackers(Position pos, EColor attackerColor) const = 0;
+
+    /**
+     * @brief Computes the material a move wins once all the captures on its final position are played out.
+     *
+     * Both players take back with their least valuable piece, including the ones lined up behind other
+     * attackers, and stop when taking back would lose material. Pinned pieces are still counted as attackers.
+     * The board is not changed. An upgrade move is counted as an upgrade to a queen.
+     *
+     * @param initialPos The position of the moving piece.
+     * @param finalPos The position the piece moves to.
+     * @return The material won in centipawns (pawn 100, horse 320, bishop 330, rook 500, queen 900), negative when it is lost.
+     * @throws InvalidBoardPositionException If a position is out of range.
+     * @throws NotInPossibleMovesException If the move is not a legal move of the current player.
+     */
+    virtual int StaticExchange(Position initialPos, Position finalPos) const = 0;
+
     /**
      * @brief Retrieves a list of pieces captured by the specified player's color.
      *
@@ -114,4 +177,24 @@ public:
      * @return `true` if castling is available for the specified player and side, otherwise `false`.
      */
     virtual bool IsCastlingAvailable(EColor color, ESide side) const = 0;
+
+    /**
+     * @brief Retrieves the Zobrist key of the current position.
+     *
+     * The key covers the pieces, the player to move, the castling rights and the en passant square,
+     * so two positions that count as the same for threefold repetition have the same key.
+     *
+     * @return The 64-bit key of the current position.
+     */
+    virtual std::uint64_t GetPositionKey() const = 0;
+
+    /**
+     * @brief Evaluates the current position without searching it, from material and piece placement.
+     *
+     * The value is kept up to date as moves are made, so calling this is cheap. It blends a middlegame
+     * and an endgame score by the material left on the board.
+     *
+     * @return The score in centipawns for the current player, positive when the current player is better.
+     */
+    virtual int Evaluate() const = 0;
 };
@@ -37,6 +37,20 @@ public:
      */
     virtual void SetRefreshRate(int milliseconds) = 0;
 
+    /**
+     * @brief Sets the time added to a player's clock after each of their moves.
+     *
+     * @param milliseconds The increment in milliseconds, 0 for none (the default).
+     */
+    virtual void SetIncrement(int milliseconds) = 0;
+
+    /**
+     * @brief Retrieves the time added to a player's clock after each of their moves.
+     *
+     * @return The increment in milliseconds.
+     */
+    virtual int GetIncrement() const = 0;
+
     /**
      * @brief Retrieves the remaining time for a player's turn.
      *
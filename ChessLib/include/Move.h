@@ -0,0 +1,284 @@
+#pragma once
+
+#include "Enums.h"
+#include "Position.h"
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief A chess move packed in 16 bits.
+ *
+ * Bits 0-5 hold the initial square, bits 6-11 the final square and bits 12-15 the kind of move
+ * together with the upgrade type. Squares are numbered row * 8 + col, so square 0 is `Position(0, 0)`.
+ */
+class Move
+{
+public:
+    /**
+     * @brief Constructs a move without a value, so move lists are not filled on construction.
+     *
+     * `Move()` and `Move{}` still give the empty move, from and to square 0.
+     */
+    Move() = default;
+
+    /**
+     * @brief Constructs a move between two squares.
+     *
+     * @param from The square of the moving piece.
+     * @param to The square the piece moves to.
+     * @param flag What the move does besides moving the piece (default is Quiet).
+     * @param promotion The type a pawn is upgraded to (default is Pawn, meaning no upgrade).
+     */
+    Move(int from, int to, EMoveFlag flag = EMoveFlag::Quiet, EType promotion = EType::Pawn);
+
+    /**
+     * @brief Retrieves the square of the moving piece.
+     */
+    int GetFrom() const;
+
+    /**
+     * @brief Retrieves the square the piece moves to.
+     */
+    int GetTo() const;
+
+    /**
+     * @brief Retrieves the position of the moving piece.
+     */
+    Position GetFromPosition() const;
+
+    /**
+     * @brief Retrieves the position the piece moves to.
+     */
+    Position GetToPosition() const;
+
+    /**
+     * @brief Retrieves what the move does besides moving the piece.
+     */
+    EMoveFlag GetFlag() const;
+
+    /**
+     * @brief Retrieves the type the pawn is upgraded to, `EType::Pawn` if the move is not an upgrade.
+     */
+    EType GetPromotion() const;
+
+    /**
+     * @brief Retrieves the packed 16-bit value of the move.
+     */
+    std::uint16_t GetData() const;
+
+    /**
+     * @brief Constructs a move from a value returned by GetData.
+     */
+    static Move FromData(std::uint16_t data);
+
+    bool operator==(const Move& other) const;
+    bool operator!=(const Move& other) const;
+
+private:
+    // Codes stored in bits 12-15: bit 2 marks a capture, bit 3 an upgrade with the type in bits 0-1 //
+    enum ECode : std::uint16_t
+    {
+        QuietCode = 0,
+        DoublePawnPushCode = 1,
+        CastleCode = 2,
+        CaptureCode = 4,
+        EnPassantCode = 5,
+        PromotionCode = 8
+    };
+
+    std::uint16_t m_data;
+};
+
+/**
+ * @brief A list of moves stored inline, without heap allocations.
+ *
+ * The capacity is above the largest number of legal moves any chess position can have (218).
+ */
+class FixedMoveList
+{
+public:
+    static const int MAX_MOVES = 256;
+
+    FixedMoveList();
+
+    void push_back(Move move);
+    void clear();
+
+    int size() const;
+    bool empty() const;
+
+    Move& operator[](int index);
+    const Move& operator[](int index) const;
+
+    const Move* begin() const;
+    const Move* end() const;
+
+private:
+    std::array<Move, MAX_MOVES> m_moves;
+    int m_size;
+};
+
+// ---		Move Inline Implementations												--- //
+
+inline Move::Move(int from, int to, EMoveFlag flag, EType promotion)
+{
+    std::uint16_t code = QuietCode;
+
+    switch (flag)
+    {
+    case EMoveFlag::DoublePawnPush:
+        code = DoublePawnPushCode;
+        break;
+    case EMoveFlag::Castle:
+        code = CastleCode;
+        break;
+    case EMoveFlag::Capture:
+        code = CaptureCode;
+        break;
+    case EMoveFlag::EnPassant:
+        code = EnPassantCode;
+        break;
+    default:
+        break;
+    }
+
+    switch (promotion)
+    {
+    case EType::Horse:
+        code |= PromotionCode | 0;
+        break;
+    case EType::Bishop:
+        code |= PromotionCode | 1;
+        break;
+    case EType::Rook:
+        code |= PromotionCode | 2;
+        break;
+    case EType::Queen:
+        code |= PromotionCode | 3;
+        break;
+    default:
+        break;
+    }
+
+    m_data = (std::uint16_t)(from | (to << 6) | (code << 12));
+}
+
+inline int Move::GetFrom() const
+{
+    return m_data & 0x3F;
+}
+
+inline int Move::GetTo() const
+{
+    return (m_data >> 6) & 0x3F;
+}
+
+inline Position Move::GetFromPosition() const
+{
+    return Position(GetFrom() / 8, GetFrom() % 8);
+}
+
+inline Position Move::GetToPosition() const
+{
+    return Position(GetTo() / 8, GetTo() % 8);
+}
+
+inline EMoveFlag Move::GetFlag() const
+{
+    std::uint16_t code = m_data >> 12;
+
+    if (code & PromotionCode)
+        return (code & CaptureCode) ? EMoveFlag::Capture : EMoveFlag::Quiet;
+
+    switch (code)
+    {
+    case DoublePawnPushCode:
+        return EMoveFlag::DoublePawnPush;
+    case CastleCode:
+        return EMoveFlag::Castle;
+    case CaptureCode:
+        return EMoveFlag::Capture;
+    case EnPassantCode:
+        return EMoveFlag::EnPassant;
+    default:
+        return EMoveFlag::Quiet;
+    }
+}
+
+inline EType Move::GetPromotion() const
+{
+    static const EType PROMOTION_TYPES[] = { EType::Horse, EType::Bishop, EType::Rook, EType::Queen };
+
+    std::uint16_t code = m_data >> 12;
+    return (code & PromotionCode) ? PROMOTION_TYPES[code & 3] : EType::Pawn;
+}
+
+inline std::uint16_t Move::GetData() const
+{
+    return m_data;
+}
+
+inline Move Move::FromData(std::uint16_t data)
+{
+    Move move;
+    move.m_data = data;
+    return move;
+}
+
+inline bool Move::operator==(const Move& other) const
+{
+    return m_data == other.m_data;
+}
+
+inline bool Move::operator!=(const Move& other) const
+{
+    return m_data != other.m_data;
+}
+
+// ---		FixedMoveList Inline Implementations											--- //
+
+inline FixedMoveList::FixedMoveList()
+    : m_size(0)
+{
+}
+
+inline void FixedMoveList::push_back(Move move)
+{
+    m_moves[m_size++] = move;
+}
+
+inline void FixedMoveList::clear()
+{
+    m_size = 0;
+}
+
+inline int FixedMoveList::size() const
+{
+    return m_size;
+}
+
+inline bool FixedMoveList::empty() const
+{
+    return m_size == 0;
+}
+
+inline Move& FixedMoveList::operator[](int index)
+{
+    return m_moves[index];
+}
+
+inline const Move& FixedMoveList::operator[](int index) const
+{
+    return m_moves[index];
+}
+
+inline const Move* FixedMoveList::begin() const
+{
+    return m_moves.data();
+}
+
+inline const Move* FixedMoveList::end() const
+{
+    return m_moves.data() + m_size;
+}
@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+
+#include "AlgebraicNotation.h"
+#include "ChessGame.h"
+
+static Move ParseMove(const BitboardPosition& position, std::string_view notation)
+{
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	Move move;
+	EXPECT_TRUE(AlgebraicNotation::ParseMove(notation, position, moves, move)) << notation;
+	return move;
+}
+
+static std::string MoveToString(const BitboardPosition& position, Move move)
+{
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	return AlgebraicNotation::MoveToString(move, position, moves);
+}
+
+TEST(TestAlgebraicNotation, Every_Legal_Move_Reads_Back)
+{
+	// r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -
+
+	CharBoard board =
+	{
+		'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',
+		'P', ' ', 'P', 'P', 'Q', 'P', 'B', ' ',
+		'B', 'H', ' ', ' ', 'P', 'H', 'P', ' ',
+		' ', ' ', ' ', 'p', 'h', ' ', ' ', ' ',
+		' ', 'P', ' ', ' ', 'p', ' ', ' ', ' ',
+		' ', ' ', 'h', ' ', ' ', 'q', ' ', 'P',
+		'p', 'p', 'p', 'b', 'b', 'p', 'p', 'p',
+		'r', ' ', ' ', ' ', 'k', ' ', ' ', 'r'
+	};
+
+	for (EColor turn : { EColor::White, EColor::Black })
+	{
+		BitboardPosition position(board, turn, { true, true, true, true });
+
+		FixedMoveList moves;
+		position.GenerateLegalMoves(moves);
+
+		for (const auto& move : moves)
+		{
+			std::string notation = AlgebraicNotation::MoveToString(move, position, moves);
+
+			Move parsed;
+			ASSERT_TRUE(AlgebraicNotation::ParseMove(notation, position, moves, parsed)) << notation;
+			EXPECT_EQ(parsed, move) << notation;
+		}
+	}
+}
+
+TEST(TestAlgebraicNotation, Disambiguates_By_File_Then_Rank)
+{
+	CharBoard board =
+	{
+		' ', ' ', ' ', ' ', 'K', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', 'h', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', 'h', ' ', 'k', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		'r', ' ', ' ', ' ', ' ', ' ', ' ', 'r'
+	};
+
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+
+	EXPECT_EQ(MoveToString(position, Move(56, 59)), "Rad1");
+	EXPECT_EQ(MoveToString(position, Move(63, 59)), "Rhd1");
+	EXPECT_EQ(MoveToString(position, Move(42, 32)), "N3a4");
+	EXPECT_EQ(MoveToString(position, Move(26, 32)), "N5a4");
+	EXPECT_EQ(MoveToString(position, Move(42, 57)), "Nb1");
+
+	EXPECT_EQ(ParseMove(position, "Rhd1"), Move(63, 59));
+	EXPECT_EQ(ParseMove(position, "N5a4"), Move(26, 32));
+	EXPECT_EQ(ParseMove(position, "Nc5a4"), Move(26, 32));
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	Move move;
+	EXPECT_FALSE(AlgebraicNotation::ParseMove("Rd1", position, moves, move));
+	EXPECT_FALSE(AlgebraicNotation::ParseMove("Na4", position, moves, move));
+	EXPECT_FALSE(AlgebraicNotation::ParseMove("Qd1", position, moves, move));
+	EXPECT_FALSE(AlgebraicNotation::ParseMove("Rd9", position, moves, move));
+	EXPECT_FALSE(AlgebraicNotation::ParseMove("+", position, moves, move));
+}
+
+TEST(TestAlgebraicNotation, Upgrades_And_Captures)
+{
+	CharBoard board =
+	{
+		'R', ' ', ' ', ' ', 'K', ' ', ' ', ' ',
+		' ', 'p', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', 'k', ' ', ' ', ' '
+	};
+
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+
+	EXPECT_EQ(MoveToString(position, Move(9, 1, EMoveFlag::Quiet, EType::Queen)), "b8=Q");
+	EXPECT_EQ(MoveToString(position, Move(9, 0, EMoveFlag::Capture, EType::Horse)), "bxa8=N");
+
+	EXPECT_EQ(ParseMove(position, "b8=R"), Move(9, 1, EMoveFlag::Quiet, EType::Rook));
+	EXPECT_EQ(ParseMove(position, "b8Q+"), Move(9, 1, EMoveFlag::Quiet, EType::Queen));
+	EXPECT_EQ(ParseMove(position, "ba8=B"), Move(9, 0, EMoveFlag::Capture, EType::Bishop));
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	Move move;
+	EXPECT_FALSE(AlgebraicNotation::ParseMove("b8", position, moves, move));
+}
+
+TEST(TestAlgebraicNotation, Game_Writes_What_It_Reads)
+{
+	ChessGame game;
+	StringMoveList moves = { "e4", "d5", "e5", "f5", "exf6", "Nc6", "Nf3", "Bg4", "Bc4", "Qd7", "O-O", "O-O-O", "fxg7", "e6", "gxh8=Q", "Be7", "Qxg8" };
+
+	ASSERT_EQ(game.PlayMoves(moves), (int)moves.size());
+	EXPECT_EQ(game.GetFormat(EFormat::Pgn),
+		"1. e4 d5 2. e5 f5 3. exf6 Nc6 4. Nf3 Bg4 5. Bc4 Qd7 6. 0-0 0-0-0 7. fxg7 e6 8. gxh8=Q Be7 9. Qxg8 ");
+
+	ChessGame replay;
+	EXPECT_EQ(replay.PlayMoves({ "e4", "e5", "Ke3" }), 2);
+}
@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+
+#include <algorithm>
+#include <thread>
+
+static int CountMoves(const ChessMoveList& moves, EMoveFlag flag)
+{
+	return std::count_if(moves.begin(), moves.end(), [flag](const ChessMove& move) { return move.flag == flag; });
+}
+
+TEST(TestAllPossibleMoves, Initial_Position)
+{
+	ChessGame game;
+
+	const ChessMoveList& moves = game.GetAllPossibleMoves();
+
+	EXPECT_EQ(moves.size(), 20);
+	EXPECT_EQ(CountMoves(moves, EMoveFlag::Quiet), 12);
+	EXPECT_EQ(CountMoves(moves, EMoveFlag::DoublePawnPush), 8);
+}
+
+TEST(TestAllPossibleMoves, Moves_Match_Possible_Moves_Of_Each_Piece)
+{
+	ChessGame game;
+
+	game.MakeMove(Position(6, 4), Position(4, 4));
+	game.MakeMove(Position(1, 3), Position(3, 3));
+
+	int count = 0;
+	for (int i = 0; i < 8; i++)
+	{
+		for (int j = 0; j < 8; j++)
+		{
+			count += game.GetPossibleMoves(Position(i, j)).size();
+		}
+	}
+
+	const ChessMoveList& moves = game.GetAllPossibleMoves();
+
+	EXPECT_EQ(moves.size(), count);
+	EXPECT_EQ(CountMoves(moves, EMoveFlag::Capture), 1);
+}
+
+TEST(TestAllPossibleMoves, List_Is_Kept_Until_Next_Move)
+{
+	ChessGame game;
+
+	const ChessMoveList& moves = game.GetAllPossibleMoves();
+	ChessMoveList initialMoves = moves;
+
+	EXPECT_EQ(&game.GetAllPossibleMoves(), &moves);
+
+	game.MakeMove(Position(6, 4), Position(4, 4));
+
+	EXPECT_EQ(game.GetAllPossibleMoves().size(), 20);
+	EXPECT_EQ(game.GetAllPossibleMoves().front().from.row, 0);
+
+	game.UndoMove();
+
+	EXPECT_EQ(game.GetAllPossibleMoves().size(), initialMoves.size());
+	EXPECT_EQ(game.GetAllPossibleMoves().front().from, initialMoves.front().from);
+}
+
+TEST(TestAllPossibleMoves, Castle_And_Upgrade_Moves)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', 'p', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			'r', ' ', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White, { true, false, false, false });
+
+	const ChessMoveList& moves = game.GetAllPossibleMoves();
+
+	EXPECT_EQ(CountMoves(moves, EMoveFlag::Castle), 1);
+	EXPECT_EQ(std::count_if(moves.begin(), moves.end(), [](const ChessMove& move) { return move.promotion != EType::Pawn; }), 4);
+}
+
+TEST(TestAllPossibleMoves, En_Passant_Move)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', 'P', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', 'P', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', 'p', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::Black, { false, false, false, false });
+
+	game.MakeMove(Position(1, 2), Position(3, 2));
+
+	const ChessMoveList& moves = game.GetAllPossibleMoves();
+
+	EXPECT_EQ(CountMoves(moves, EMoveFlag::EnPassant), 1);
+	EXPECT_EQ(CountMoves(moves, EMoveFlag::Capture), 1);
+}
+
+TEST(TestAllPossibleMoves, Threads_Can_Query_The_Same_Position)
+{
+	ChessGame game;
+	game.MakeMove(Position(6, 4), Position(4, 4));
+
+	std::vector<std::size_t> counts(4);
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < counts.size(); i++)
+	{
+		threads.emplace_back([&game, &counts, i]() { counts[i] = game.GetAllPossibleMoves().size(); });
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (std::size_t count : counts)
+	{
+		EXPECT_EQ(count, 20u);
+	}
+}
@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "ChessException.h"
+
+#include <algorithm>
+#include <thread>
+
+TEST(TestAttackMap, Initial_Position_Attacks)
+{
+	ChessGame game;
+
+	// Pawns and knights cover the third row, nothing reaches the middle //
+	for (int j = 0; j < 8; j++)
+	{
+		EXPECT_TRUE(game.IsAttacked(Position(5, j), EColor::White));
+		EXPECT_FALSE(game.IsAttacked(Position(5, j), EColor::Black));
+		EXPECT_FALSE(game.IsAttacked(Position(4, j), EColor::White));
+	}
+
+	// Defended pieces are attacked by their own color //
+	EXPECT_TRUE(game.IsAttacked(Position(6, 4), EColor::White));
+	EXPECT_FALSE(game.IsAttacked(Position(7, 0), EColor::White));
+
+	PositionList attackers = game.GetAttackers(Position(5, 5), EColor::White);
+
+	EXPECT_EQ(attackers.size(), 3);
+	EXPECT_NE(std::find(attackers.begin(), attackers.end(), Position(7, 6)), attackers.end());
+	EXPECT_NE(std::find(attackers.begin(), attackers.end(), Position(6, 4)), attackers.end());
+	EXPECT_NE(std::find(attackers.begin(), attackers.end(), Position(6, 6)), attackers.end());
+}
+
+TEST(TestAttackMap, Attacks_Follow_The_Moves)
+{
+	ChessGame game;
+
+	game.MakeMove(Position(6, 4), Position(4, 4));
+
+	EXPECT_TRUE(game.IsAttacked(Position(3, 5), EColor::White));
+	EXPECT_TRUE(game.IsAttacked(Position(2, 0), EColor::White));
+	EXPECT_EQ(game.GetAttackers(Position(3, 7), EColor::White), PositionList({ Position(7, 3) }));
+
+	game.UndoMove();
+
+	EXPECT_FALSE(game.IsAttacked(Position(3, 5), EColor::White));
+	EXPECT_TRUE(game.GetAttackers(Position(3, 7), EColor::White).empty());
+}
+
+TEST(TestAttackMap, Sliders_Are_Blocked)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			'R', ' ', ' ', 'p', ' ', ' ', ' ', 'q',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White, { false, false, false, false });
+
+	EXPECT_EQ(game.GetAttackers(Position(3, 3), EColor::Black), PositionList({ Position(3, 0) }));
+	EXPECT_EQ(game.GetAttackers(Position(3, 3), EColor::White), PositionList({ Position(3, 7) }));
+	EXPECT_FALSE(game.IsAttacked(Position(3, 2), EColor::White));
+	EXPECT_THROW(game.IsAttacked(Position(8, 0), EColor::White), InvalidBoardPositionException);
+}
+
+TEST(TestAttackMap, Threads_Can_Query_The_Same_Position)
+{
+	ChessGame game;
+	game.MakeMove(Position(6, 4), Position(4, 4));
+
+	std::vector<std::size_t> counts(4);
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < counts.size(); i++)
+	{
+		threads.emplace_back([&game, &counts, i]() { counts[i] = game.GetAttackers(Position(5, 5), EColor::White).size(); });
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	// The pawn on g2, the knight on g1 and the queen on d1 //
+	for (std::size_t count : counts)
+	{
+		EXPECT_EQ(count, 3u);
+	}
+}
@@ -0,0 +1,211 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "ChessException.h"
+#include "IChessEngine.h"
+
+TEST(TestChessEngine, Finds_Mate_In_One)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', ' ', ' ', 'K', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', 'P', 'P', 'P',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', 'p', 'p', 'p',   // 6
+			'r', ' ', ' ', ' ', ' ', ' ', 'k', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White, { false, false, false, false });
+
+	SearchLimits limits;
+	limits.depth = 4;
+
+	SearchResult result = IChessEngine::CreateEngine()->Search(game, limits);
+
+	EXPECT_EQ(result.bestMove.from, Position(7, 0));
+	EXPECT_EQ(result.bestMove.to, Position(0, 0));
+	EXPECT_EQ(result.score, IChessEngine::MATE_SCORE - 1);
+	EXPECT_EQ(result.principalVariation.size(), 1);
+}
+
+TEST(TestChessEngine, Takes_Hanging_Queen)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', 'Q', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', 'r', ' ', ' ', 'k', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White, { false, false, false, false });
+
+	SearchLimits limits;
+	limits.depth = 3;
+
+	SearchResult result = IChessEngine::CreateEngine()->Search(game, limits);
+
+	EXPECT_EQ(result.bestMove.from, Position(7, 3));
+	EXPECT_EQ(result.bestMove.to, Position(3, 3));
+	EXPECT_EQ(result.bestMove.flag, EMoveFlag::Capture);
+	EXPECT_GT(result.score, 400);
+	EXPECT_EQ(result.depth, 3);
+}
+
+TEST(TestChessEngine, Quiescence_Sees_The_Recapture)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', 'P', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', 'P', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', 'q', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', ' ', ' ', 'k', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White, { false, false, false, false });
+
+	SearchLimits limits;
+	limits.depth = 1;
+
+	SearchResult result = IChessEngine::CreateEngine()->Search(game, limits);
+
+	// Taking the defended pawn looks good at depth 1 only without the quiescence search //
+	EXPECT_FALSE(result.bestMove.from == Position(6, 4) && result.bestMove.to == Position(3, 4));
+	EXPECT_GT(result.score, 400);
+}
+
+TEST(TestChessEngine, Principal_Variation_Is_Playable)
+{
+	ChessGame game;
+
+	SearchLimits limits;
+	limits.depth = 4;
+
+	SearchResult result = IChessEngine::CreateEngine()->Search(game, limits);
+
+	ASSERT_FALSE(result.principalVariation.empty());
+	EXPECT_EQ(result.principalVariation.front().from, result.bestMove.from);
+	EXPECT_EQ(result.principalVariation.front().to, result.bestMove.to);
+
+	for (const auto& move : result.principalVariation)
+	{
+		EXPECT_NO_THROW(game.MakeMove(move.from, move.to));
+	}
+
+	// The search does not change the game it was given //
+	EXPECT_EQ(game.GetNumberOfMoves(), result.principalVariation.size() + 1);
+}
+
+TEST(TestChessEngine, Node_Limit_Stops_The_Search)
+{
+	ChessGame game;
+
+	SearchLimits limits;
+	limits.nodes = 5000;
+
+	SearchResult result = IChessEngine::CreateEngine()->Search(game, limits);
+
+	EXPECT_GE(result.depth, 1);
+	EXPECT_LE(result.nodes, 5000);
+	EXPECT_FALSE(result.principalVariation.empty());
+}
+
+TEST(TestChessEngine, Search_Without_Moves_Throws)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', 'q', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', 'k', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::Black, { false, false, false, false });
+
+	EXPECT_THROW(IChessEngine::CreateEngine()->Search(game, SearchLimits()), InvalidStateException);
+}
+
+TEST(TestChessEngine, Single_Thread_Search_Is_Deterministic)
+{
+	ChessGame game;
+	game.MakeMove(Position(6, 4), Position(4, 4));
+
+	SearchLimits limits;
+	limits.depth = 5;
+
+	SearchResult first = IChessEngine::CreateEngine()->Search(game, limits);
+	SearchResult second = IChessEngine::CreateEngine()->Search(game, limits);
+
+	EXPECT_EQ(first.nodes, second.nodes);
+	EXPECT_EQ(first.score, second.score);
+	ASSERT_EQ(first.principalVariation.size(), second.principalVariation.size());
+	for (std::size_t i = 0; i < first.principalVariation.size(); i++)
+	{
+		EXPECT_EQ(first.principalVariation[i].from, second.principalVariation[i].from);
+		EXPECT_EQ(first.principalVariation[i].to, second.principalVariation[i].to);
+	}
+}
+
+TEST(TestChessEngine, Helper_Threads_Search_Together)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', ' ', ' ', 'K', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', 'P', 'P', 'P',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', 'p', 'p', 'p',   // 6
+			'r', ' ', ' ', ' ', ' ', ' ', 'k', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White, { false, false, false, false });
+
+	IChessEnginePtr engine = IChessEngine::CreateEngine();
+	engine->SetThreadCount(4);
+
+	EXPECT_EQ(engine->GetThreadCount(), 4);
+
+	SearchLimits limits;
+	limits.depth = 5;
+
+	// The pool is reused by every search //
+	for (int i = 0; i < 3; i++)
+	{
+		SearchResult result = engine->Search(game, limits);
+
+		EXPECT_EQ(result.bestMove.to, Position(0, 0));
+		EXPECT_EQ(result.score, IChessEngine::MATE_SCORE - 1);
+	}
+
+	engine->SetThreadCount(1);
+
+	EXPECT_EQ(engine->GetThreadCount(), 1);
+	EXPECT_EQ(engine->Search(game, limits).bestMove.to, Position(0, 0));
+}
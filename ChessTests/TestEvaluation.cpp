@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "BitboardPosition.h"
+
+#include <cctype>
+
+static void CheckEvaluation(BitboardPosition& position, int depth)
+{
+	ASSERT_EQ(position.Evaluate(), position.ComputeEvaluation());
+
+	if (depth == 0)
+		return;
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	for (const auto& move : moves)
+	{
+		int score = position.Evaluate();
+
+		UndoInfo undo = position.MakeMove(move);
+		CheckEvaluation(position, depth - 1);
+		position.UnmakeMove(undo);
+
+		ASSERT_EQ(position.Evaluate(), score);
+	}
+}
+
+TEST(TestEvaluation, Incremental_Score_Matches_Computed_Score)
+{
+	// Kiwipete: castles, en passant and promotions within three plies //
+
+	CharBoard board =
+	{
+		'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',
+		'P', ' ', 'P', 'P', 'Q', 'P', 'B', ' ',
+		'B', 'H', ' ', ' ', 'P', 'H', 'P', ' ',
+		' ', ' ', ' ', 'p', 'h', ' ', ' ', ' ',
+		' ', 'P', ' ', ' ', 'p', ' ', ' ', ' ',
+		' ', ' ', 'h', ' ', ' ', 'q', ' ', 'P',
+		'p', 'p', 'p', 'b', 'b', 'p', 'p', 'p',
+		'r', ' ', ' ', ' ', 'k', ' ', ' ', 'r'
+	};
+
+	BitboardPosition position(board, EColor::White, { true, true, true, true });
+
+	CheckEvaluation(position, 3);
+}
+
+TEST(TestEvaluation, Mirrored_Position_Has_The_Same_Score)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', 'K', ' ', ' ', ' ',   // 0
+			'P', 'P', ' ', ' ', ' ', 'P', 'P', 'P',   // 1
+			' ', ' ', 'H', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', 'P', ' ', ' ', ' ',   // 3
+			' ', ' ', 'b', ' ', 'p', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			'p', 'p', 'p', ' ', ' ', 'p', 'p', 'p',   // 6
+			' ', ' ', ' ', 'r', ' ', ' ', 'k', ' '    // 7
+	};
+
+	// Rows upside down and colors swapped: the other player stands exactly the same //
+	CharBoard mirrored;
+	for (int i = 0; i < 8; i++)
+	{
+		for (int j = 0; j < 8; j++)
+		{
+			char c = board[7 - i][j];
+			mirrored[i][j] = islower(c) ? (char)toupper(c) : (char)tolower(c);
+		}
+	}
+
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+	BitboardPosition mirroredPosition(mirrored, EColor::Black, { false, false, false, false });
+
+	EXPECT_EQ(position.Evaluate(), mirroredPosition.Evaluate());
+	EXPECT_GT(position.Evaluate(), 0);
+}
+
+TEST(TestEvaluation, Score_Is_For_The_Current_Player)
+{
+	ChessGame game;
+
+	EXPECT_EQ(game.Evaluate(), 0);
+
+	game.MakeMove(Position(6, 4), Position(4, 4));
+
+	int blackScore = game.Evaluate();
+	EXPECT_LT(blackScore, 0);
+
+	game.MakeMove(Position(1, 4), Position(3, 4));
+	game.UndoMove();
+
+	EXPECT_EQ(game.Evaluate(), blackScore);
+}
+
+TEST(TestEvaluation, Endgame_Tables_Take_Over_With_Less_Material)
+{
+	// Only kings and pawns left: the king in the center is worth more than in the corner //
+
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', 'P', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', 'k', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', 'p', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '    // 7
+	};
+
+	CharBoard cornerBoard = board;
+	cornerBoard[4][3] = ' ';
+	cornerBoard[7][7] = 'k';
+
+	BitboardPosition center(board, EColor::White, { false, false, false, false });
+	BitboardPosition corner(cornerBoard, EColor::White, { false, false, false, false });
+
+	EXPECT_GT(center.Evaluate(), corner.Evaluate());
+	EXPECT_GT(center.Evaluate(), 0);
+}
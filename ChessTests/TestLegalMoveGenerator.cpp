@@ -0,0 +1,115 @@
+#include "gtest/gtest.h"
+
+#include "BitboardPosition.h"
+
+static int CountMovesFrom(const FixedMoveList& moves, Position from)
+{
+	int count = 0;
+	for (const auto& move : moves)
+	{
+		if (move.GetFrom() == ToSquare(from))
+			count++;
+	}
+	return count;
+}
+
+TEST(TestLegalMoveGenerator, Pinned_Piece_Moves_Only_Along_The_Pin)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', 'R', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', 'r', ' ', ' ', 'B',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', 'q', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	// The rook stays on the e file, the queen can only take the bishop or move towards it //
+	EXPECT_EQ(CountMovesFrom(moves, Position(4, 4)), 6);
+	EXPECT_EQ(CountMovesFrom(moves, Position(6, 5)), 2);
+}
+
+TEST(TestLegalMoveGenerator, Double_Check_Allows_Only_King_Moves)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', 'R', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', 'H', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', 'q',   // 6
+			' ', 'r', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	EXPECT_EQ(moves.size(), CountMovesFrom(moves, Position(7, 4)));
+	EXPECT_EQ(moves.size(), 3);
+}
+
+TEST(TestLegalMoveGenerator, Single_Check_Is_Blocked_Or_Captured)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', 'R', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			'r', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', 'p', 'k', ' ', ' ', ' '    // 7
+	};
+
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	// The rook can only block on e2, the pawn move does not help //
+	EXPECT_EQ(CountMovesFrom(moves, Position(6, 0)), 1);
+	EXPECT_EQ(CountMovesFrom(moves, Position(7, 3)), 0);
+	EXPECT_EQ(position.IsInCheck(EColor::White), true);
+}
+
+TEST(TestLegalMoveGenerator, En_Passant_Can_Not_Uncover_The_King)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', 'K',   // 0
+			' ', ' ', 'P', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			'k', ' ', ' ', 'p', ' ', ' ', ' ', 'R',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '    // 7
+	};
+
+	BitboardPosition position(board, EColor::Black, { false, false, false, false });
+	position.MakeMove(ToSquare(Position(1, 2)), ToSquare(Position(3, 2)));
+
+	// Taking c6 would leave the king on a5 alone on the row with the rook //
+	EXPECT_EQ(position.GetLegalTargets(ToSquare(Position(3, 3))), SquareBB(ToSquare(Position(2, 3))));
+}
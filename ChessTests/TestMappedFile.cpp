@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "MappedFile.h"
+
+#include <fstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static std::string WriteFile(const std::string& name, const std::string& text)
+{
+	std::string fileName = testing::TempDir() + name;
+	std::ofstream file(fileName, std::ios::binary);
+	file << text;
+	return fileName;
+}
+
+TEST(TestMappedFile, Regular_File_Is_Mapped)
+{
+	std::string text = "[Event \"Mapped\"]\r\n\r\n1. e4 e5 *\r\n";
+
+	MappedFile file;
+	ASSERT_TRUE(file.Open(WriteFile("mapped.pgn", text)));
+
+	EXPECT_TRUE(file.IsMapped());
+	EXPECT_EQ(file.GetText(), text);
+
+	file.Close();
+	EXPECT_TRUE(file.GetText().empty());
+}
+
+TEST(TestMappedFile, Empty_And_Missing_Files)
+{
+	MappedFile file;
+	ASSERT_TRUE(file.Open(WriteFile("empty.pgn", "")));
+	EXPECT_TRUE(file.GetText().empty());
+
+	EXPECT_FALSE(file.Open(testing::TempDir() + "missing.pgn"));
+}
+
+#ifndef _WIN32
+TEST(TestMappedFile, Pipe_Is_Read_Into_A_Buffer)
+{
+	std::string fileName = testing::TempDir() + "pipe.pgn";
+	unlink(fileName.c_str());
+	ASSERT_EQ(mkfifo(fileName.c_str(), 0600), 0);
+
+	// Larger than one read, so the buffer has to grow //
+	std::string text(200000, ' ');
+	text.replace(0, 6, "1. e4 ");
+
+	std::thread writer([&fileName, &text]()
+		{
+			std::ofstream pipe(fileName, std::ios::binary);
+			pipe << text;
+		});
+
+	MappedFile file;
+	EXPECT_TRUE(file.Open(fileName));
+	writer.join();
+
+	EXPECT_FALSE(file.IsMapped());
+	EXPECT_EQ(file.GetText(), text);
+
+	unlink(fileName.c_str());
+}
+#endif
+
+TEST(TestMappedFile, Game_Loads_From_A_Mapped_File)
+{
+	ChessGame game;
+	ASSERT_TRUE(game.LoadFromFile(EFormat::Pgn, WriteFile("game.pgn", "[Event \"Load\"]\n\n1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 *\n")));
+
+	EXPECT_EQ(game.GetFormat(EFormat::Pgn), "1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 ");
+}
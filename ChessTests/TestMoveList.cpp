@@ -0,0 +1,91 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+
+TEST(TestMoveList, Move_Keeps_Squares_Flag_And_Upgrade_Type)
+{
+	Move quiet(52, 36, EMoveFlag::DoublePawnPush);
+
+	EXPECT_EQ(sizeof(Move), 2);
+	EXPECT_EQ(quiet.GetFrom(), 52);
+	EXPECT_EQ(quiet.GetTo(), 36);
+	EXPECT_EQ(quiet.GetFromPosition(), Position(6, 4));
+	EXPECT_EQ(quiet.GetToPosition(), Position(4, 4));
+	EXPECT_EQ(quiet.GetFlag(), EMoveFlag::DoublePawnPush);
+	EXPECT_EQ(quiet.GetPromotion(), EType::Pawn);
+
+	for (EType type : { EType::Horse, EType::Bishop, EType::Rook, EType::Queen })
+	{
+		Move upgrade(9, 0, EMoveFlag::Capture, type);
+
+		EXPECT_EQ(upgrade.GetFrom(), 9);
+		EXPECT_EQ(upgrade.GetTo(), 0);
+		EXPECT_EQ(upgrade.GetFlag(), EMoveFlag::Capture);
+		EXPECT_EQ(upgrade.GetPromotion(), type);
+	}
+
+	EXPECT_NE(Move(9, 0, EMoveFlag::Capture, EType::Queen), Move(9, 0, EMoveFlag::Quiet, EType::Queen));
+	EXPECT_EQ(Move(63, 63, EMoveFlag::EnPassant).GetFlag(), EMoveFlag::EnPassant);
+}
+
+TEST(TestMoveList, Possible_Moves_Match_Position_List)
+{
+	ChessGame game;
+
+	game.MakeMove(Position(6, 4), Position(4, 4));
+	game.MakeMove(Position(1, 3), Position(3, 3));
+
+	FixedMoveList moves;
+
+	for (int i = 0; i < 8; i++)
+	{
+		for (int j = 0; j < 8; j++)
+		{
+			PositionList positions = game.GetPossibleMoves(Position(i, j));
+			game.GetPossibleMoves(Position(i, j), moves);
+
+			ASSERT_EQ(moves.size(), (int)positions.size());
+			for (int k = 0; k < moves.size(); k++)
+			{
+				EXPECT_EQ(moves[k].GetFromPosition(), Position(i, j));
+				EXPECT_NE(std::find(positions.begin(), positions.end(), moves[k].GetToPosition()), positions.end());
+			}
+		}
+	}
+
+	game.GetPossibleMoves(Position(4, 4), moves);
+
+	EXPECT_EQ(moves.size(), 2);
+	EXPECT_EQ(std::count_if(moves.begin(), moves.end(), [](Move move) { return move.GetFlag() == EMoveFlag::Capture; }), 1);
+}
+
+TEST(TestMoveList, Upgrade_Is_Listed_For_Every_Type)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', 'R', ' ', ' ', ' ', ' ', 'K',   // 0
+			' ', 'p', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White, { false, false, false, false });
+
+	FixedMoveList moves;
+	game.GetPossibleMoves(Position(1, 1), moves);
+
+	// b8 is free and c8 holds a rook: 4 upgrade types for each //
+	EXPECT_EQ(moves.size(), 8);
+	EXPECT_EQ(std::count_if(moves.begin(), moves.end(), [](Move move) { return move.GetFlag() == EMoveFlag::Capture; }), 4);
+	EXPECT_EQ(std::count_if(moves.begin(), moves.end(), [](Move move) { return move.GetPromotion() == EType::Queen; }), 2);
+
+	game.GetPossibleMoves(Position(0, 7), moves);
+
+	EXPECT_TRUE(moves.empty());
+}
@@ -0,0 +1,173 @@
+#include "gtest/gtest.h"
+
+#include "MovePicker.h"
+
+#include <algorithm>
+#include <vector>
+
+static const CharBoard KIWIPETE_BOARD =
+{
+	'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',
+	'P', ' ', 'P', 'P', 'Q', 'P', 'B', ' ',
+	'B', 'H', ' ', ' ', 'P', 'H', 'P', ' ',
+	' ', ' ', ' ', 'p', 'h', ' ', ' ', ' ',
+	' ', 'P', ' ', ' ', 'p', ' ', ' ', ' ',
+	' ', ' ', 'h', ' ', ' ', 'q', ' ', 'P',
+	'p', 'p', 'p', 'b', 'b', 'p', 'p', 'p',
+	'r', ' ', ' ', ' ', 'k', ' ', ' ', 'r'
+};
+
+static Move MakeMove(Position from, Position to, EMoveFlag flag = EMoveFlag::Quiet)
+{
+	return Move(ToSquare(from), ToSquare(to), flag);
+}
+
+static std::vector<std::uint16_t> ToSortedData(const std::vector<Move>& moves)
+{
+	std::vector<std::uint16_t> data;
+	for (Move move : moves)
+		data.push_back(move.GetData());
+
+	std::sort(data.begin(), data.end());
+	return data;
+}
+
+static std::vector<Move> PickAll(MovePicker& picker)
+{
+	std::vector<Move> moves;
+
+	Move move;
+	while (picker.Next(move))
+		moves.push_back(move);
+
+	return moves;
+}
+
+TEST(TestMovePicker, Captures_And_Quiets_Split_The_Legal_Moves)
+{
+	BitboardPosition position(KIWIPETE_BOARD, EColor::White, { true, true, true, true });
+
+	FixedMoveList all, captures, quiets;
+	position.GenerateLegalMoves(all);
+	position.GenerateLegalMoves(captures, EMoveKind::Captures);
+	position.GenerateLegalMoves(quiets, EMoveKind::Quiets);
+
+	EXPECT_EQ(captures.size(), 8);
+	EXPECT_EQ(captures.size() + quiets.size(), all.size());
+
+	for (Move move : captures)
+		EXPECT_FALSE(MovePicker::IsQuiet(move));
+	for (Move move : quiets)
+		EXPECT_TRUE(MovePicker::IsQuiet(move));
+}
+
+TEST(TestMovePicker, Every_Legal_Move_Is_Picked_Once)
+{
+	BitboardPosition position(KIWIPETE_BOARD, EColor::White, { true, true, true, true });
+	HistoryTable history = {};
+
+	FixedMoveList legalMoves;
+	position.GenerateLegalMoves(legalMoves);
+	std::vector<Move> expected(legalMoves.begin(), legalMoves.end());
+
+	// The hash move and a killer are legal, the other killer and the counter move are from another position //
+	Move hashMove = MakeMove(Position(5, 5), Position(2, 5), EMoveFlag::Capture);
+	Move killer = MakeMove(Position(7, 4), Position(7, 5));
+	Move illegalKiller = MakeMove(Position(6, 0), Position(3, 0));
+	Move illegalCounterMove = MakeMove(Position(5, 5), Position(2, 5));
+
+	MovePicker picker(position, hashMove, { killer, illegalKiller }, illegalCounterMove, history);
+	std::vector<Move> picked = PickAll(picker);
+
+	EXPECT_EQ(picked.front(), hashMove);
+	EXPECT_EQ(ToSortedData(picked), ToSortedData(expected));
+}
+
+TEST(TestMovePicker, Stages_Come_In_Order)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', 'K', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', 'P', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', 'H', ' ', ' ', ' ', 'q',   // 3
+			' ', ' ', ' ', ' ', 'p', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', ' ', ' ', 'k', ' '    // 7
+	};
+
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+	HistoryTable history = {};
+
+	Move hashMove = MakeMove(Position(7, 6), Position(7, 7));
+	Move killer = MakeMove(Position(3, 7), Position(2, 7));
+
+	MovePicker picker(position, hashMove, { killer, Move() }, Move(), history);
+	std::vector<Move> picked = PickAll(picker);
+
+	ASSERT_GE(picked.size(), 5u);
+
+	// Pawn takes knight before queen takes knight, the defended pawn on f7 comes last //
+	EXPECT_EQ(picked[0], hashMove);
+	EXPECT_EQ(picked[1], MakeMove(Position(4, 4), Position(3, 3), EMoveFlag::Capture));
+	EXPECT_EQ(picked[2], MakeMove(Position(3, 7), Position(3, 3), EMoveFlag::Capture));
+	EXPECT_EQ(picked[3], killer);
+	EXPECT_EQ(picked.back(), MakeMove(Position(3, 7), Position(1, 5), EMoveFlag::Capture));
+}
+
+TEST(TestMovePicker, Quiescence_Picks_Only_Good_Captures)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', 'K', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', 'P', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', 'H', ' ', ' ', ' ', 'q',   // 3
+			' ', ' ', ' ', ' ', 'p', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', ' ', ' ', 'k', ' '    // 7
+	};
+
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+	HistoryTable history = {};
+
+	MovePicker picker(position, history);
+	std::vector<Move> picked = PickAll(picker);
+
+	// The queen taking the defended pawn on f7 loses material //
+	ASSERT_EQ(picked.size(), 2u);
+	EXPECT_EQ(picked[0], MakeMove(Position(4, 4), Position(3, 3), EMoveFlag::Capture));
+	EXPECT_EQ(picked[1], MakeMove(Position(3, 7), Position(3, 3), EMoveFlag::Capture));
+
+	// In check every evasion is picked //
+	board[1][5] = ' ';
+	board[0][4] = ' ';
+	board[0][6] = 'K';
+	board[2][6] = 'R';
+	BitboardPosition checked(board, EColor::White, { false, false, false, false });
+
+	FixedMoveList evasions;
+	checked.GenerateLegalMoves(evasions);
+
+	MovePicker evasionPicker(checked, history);
+	EXPECT_EQ(PickAll(evasionPicker).size(), (size_t)evasions.size());
+}
+
+TEST(TestMovePicker, Moves_From_Another_Position_Are_Not_Legal)
+{
+	BitboardPosition position(KIWIPETE_BOARD, EColor::White, { true, true, true, true });
+
+	EXPECT_TRUE(position.IsLegal(MakeMove(Position(7, 4), Position(7, 6), EMoveFlag::Castle)));
+	EXPECT_TRUE(position.IsLegal(MakeMove(Position(6, 0), Position(4, 0), EMoveFlag::DoublePawnPush)));
+
+	// Right squares with the wrong flag, a blocked pawn and a black piece //
+	EXPECT_FALSE(position.IsLegal(MakeMove(Position(5, 5), Position(2, 5))));
+	EXPECT_FALSE(position.IsLegal(MakeMove(Position(6, 2), Position(5, 2))));
+	EXPECT_FALSE(position.IsLegal(MakeMove(Position(1, 0), Position(2, 0))));
+}
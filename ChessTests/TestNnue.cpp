@@ -0,0 +1,147 @@
+#include "gtest/gtest.h"
+
+#include "Nnue.h"
+#include "BitboardPosition.h"
+#include "ChessGame.h"
+#include "IChessEngine.h"
+
+#include <fstream>
+#include <vector>
+
+static const CharBoard KIWIPETE_BOARD =
+{
+	'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',
+	'P', ' ', 'P', 'P', 'Q', 'P', 'B', ' ',
+	'B', 'H', ' ', ' ', 'P', 'H', 'P', ' ',
+	' ', ' ', ' ', 'p', 'h', ' ', ' ', ' ',
+	' ', 'P', ' ', ' ', 'p', ' ', ' ', ' ',
+	' ', ' ', 'h', ' ', ' ', 'q', ' ', 'P',
+	'p', 'p', 'p', 'b', 'b', 'p', 'p', 'p',
+	'r', ' ', ' ', ' ', 'k', ' ', ' ', 'r'
+};
+
+// Writes a network with weights from a fixed-seed generator, wide enough for the ReLU to clip //
+static std::string WriteNetwork(const std::string& name, std::uint32_t hidden = Nnue::HIDDEN, bool trailingByte = false)
+{
+	std::string fileName = testing::TempDir() + name;
+	std::ofstream file(fileName, std::ios::binary);
+
+	std::uint32_t state = 12345;
+	auto nextWeight = [&state](int range)
+	{
+		state = state * 1103515245 + 12345;
+		return (std::int16_t)((int)((state >> 16) % (2 * range + 1)) - range);
+	};
+
+	std::uint32_t inputs = Nnue::INPUTS;
+	file.write("CLNN", 4);
+	file.write(reinterpret_cast<const char*>(&inputs), sizeof(inputs));
+	file.write(reinterpret_cast<const char*>(&hidden), sizeof(hidden));
+
+	std::vector<std::int16_t> weights;
+	for (std::uint32_t i = 0; i < Nnue::INPUTS * hidden; i++)
+		weights.push_back(nextWeight(120));
+	for (std::uint32_t i = 0; i < hidden; i++)
+		weights.push_back(nextWeight(200));
+	for (std::uint32_t i = 0; i < 2 * hidden; i++)
+		weights.push_back(nextWeight(64));
+	file.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(std::int16_t));
+
+	std::int32_t outputBias = 1000;
+	file.write(reinterpret_cast<const char*>(&outputBias), sizeof(outputBias));
+
+	if (trailingByte)
+		file.put(0);
+
+	return fileName;
+}
+
+static void CheckAccumulator(BitboardPosition& position, int depth)
+{
+	ASSERT_EQ(position.Evaluate(), position.ComputeEvaluation());
+
+	if (depth == 0)
+		return;
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	for (const auto& move : moves)
+	{
+		int score = position.Evaluate();
+
+		UndoInfo undo = position.MakeMove(move);
+		CheckAccumulator(position, depth - 1);
+		position.UnmakeMove(undo);
+
+		ASSERT_EQ(position.Evaluate(), score);
+	}
+}
+
+TEST(TestNnue, Load_Rejects_Invalid_Files)
+{
+	EXPECT_EQ(Nnue::Network::Load(testing::TempDir() + "missing.nnue"), nullptr);
+	EXPECT_EQ(Nnue::Network::Load(WriteNetwork("small.nnue", 128)), nullptr);
+	EXPECT_EQ(Nnue::Network::Load(WriteNetwork("long.nnue", Nnue::HIDDEN, true)), nullptr);
+
+	EXPECT_NE(Nnue::Network::Load(WriteNetwork("valid.nnue")), nullptr);
+}
+
+TEST(TestNnue, Incremental_Accumulator_Matches_Refreshed_Accumulator)
+{
+	auto network = Nnue::Network::Load(WriteNetwork("valid.nnue"));
+	ASSERT_NE(network, nullptr);
+
+	Nnue::Accumulator accumulator(*network);
+	BitboardPosition position(KIWIPETE_BOARD, EColor::White, { true, true, true, true });
+	position.SetAccumulator(&accumulator);
+
+	CheckAccumulator(position, 2);
+}
+
+TEST(TestNnue, Every_Kernel_Gives_The_Scalar_Result)
+{
+	auto network = Nnue::Network::Load(WriteNetwork("valid.nnue"));
+	ASSERT_NE(network, nullptr);
+
+	Nnue::Accumulator accumulator(*network);
+	BitboardPosition position(KIWIPETE_BOARD, EColor::White, { true, true, true, true });
+	position.SetAccumulator(&accumulator);
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	for (const auto& move : moves)
+	{
+		UndoInfo undo = position.MakeMove(move);
+
+		for (Nnue::EKernel kernel : { Nnue::EKernel::Sse41, Nnue::EKernel::Avx2 })
+		{
+			if (!Nnue::IsKernelSupported(kernel))
+				continue;
+
+			for (EColor turn : { EColor::White, EColor::Black })
+				EXPECT_EQ(accumulator.Evaluate(turn, kernel), accumulator.Evaluate(turn, Nnue::EKernel::Scalar));
+		}
+
+		position.UnmakeMove(undo);
+	}
+}
+
+TEST(TestNnue, Engine_Searches_With_A_Network)
+{
+	IChessEnginePtr engine = IChessEngine::CreateEngine();
+
+	EXPECT_FALSE(engine->LoadNetwork(testing::TempDir() + "missing.nnue"));
+	ASSERT_TRUE(engine->LoadNetwork(WriteNetwork("valid.nnue")));
+
+	ChessGame game;
+
+	SearchLimits limits;
+	limits.depth = 3;
+
+	SearchResult result = engine->Search(game, limits);
+
+	EXPECT_EQ(result.depth, 3);
+	EXPECT_NO_THROW(game.MakeMove(result.bestMove.from, result.bestMove.to));
+}
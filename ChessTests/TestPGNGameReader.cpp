@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+
+#include "PGNGameReader.h"
+#include "PGNReader.h"
+
+#include <fstream>
+
+static const std::string ARCHIVE =
+	"[Event \"First\"]\r\n"
+	"[White \"A \\\"The Rook\\\" B\"]\r\n"
+	"\r\n"
+	"1. e4 e5 2. Nf3 {a comment\r\n"
+	"[not a tag] still the comment} Nc6 1-0\r\n"
+	"\r\n"
+	"[Event \"Second\"] [Round \"2\"]\n"
+	"1. d4 d5 1/2-1/2\n"
+	"\n"
+	"\n"
+	"[Event \"Third\"]\n"
+	"\n"
+	"1. c4 *";
+
+static std::string WriteArchive(const std::string& name)
+{
+	std::string fileName = testing::TempDir() + name;
+	std::ofstream file(fileName, std::ios::binary);
+	file << ARCHIVE;
+	return fileName;
+}
+
+TEST(TestPGNGameReader, Reads_Games_One_At_A_Time)
+{
+	PGNGameReader reader;
+	ASSERT_TRUE(reader.Open(WriteArchive("archive.pgn")));
+
+	PGNGame game;
+	ASSERT_TRUE(reader.ReadGame(game));
+
+	EXPECT_EQ(game.offset, 0u);
+	EXPECT_EQ(game.tags.size(), 2u);
+	EXPECT_EQ(game.GetTag("Event"), "First");
+	EXPECT_EQ(game.GetTag("White"), "A \"The Rook\" B");
+	EXPECT_EQ(game.GetTag("Black"), "");
+	EXPECT_EQ(game.moveText, "1. e4 e5 2. Nf3 {a comment\n[not a tag] still the comment} Nc6 1-0\n\n");
+
+	PGNReader moves;
+	moves.LoadFromString(game.moveText);
+	EXPECT_EQ(moves.GetMoves(), StringMoveList({ "e4", "e5", "Nf3", "Nc6" }));
+
+	ASSERT_TRUE(reader.ReadGame(game));
+	EXPECT_EQ(game.offset, ARCHIVE.find("[Event \"Second\"]"));
+	EXPECT_EQ(game.GetTag("Round"), "2");
+	EXPECT_EQ(game.moveText, "1. d4 d5 1/2-1/2\n\n\n");
+
+	EXPECT_EQ(reader.GetGameNumber(), 2u);
+
+	ASSERT_TRUE(reader.ReadGame(game));
+	EXPECT_EQ(game.GetTag("Event"), "Third");
+	EXPECT_EQ(game.moveText, "1. c4 *\n");
+
+	EXPECT_FALSE(reader.ReadGame(game));
+	EXPECT_EQ(reader.GetGameNumber(), 3u);
+}
+
+TEST(TestPGNGameReader, Index_Holds_The_Offset_Of_Every_Game)
+{
+	PGNGameReader reader;
+	ASSERT_TRUE(reader.Open(WriteArchive("indexed.pgn")));
+
+	// Building the index does not move the reader //
+	EXPECT_TRUE(reader.SkipGame());
+	reader.BuildIndex();
+
+	PGNIndex expected = { 0, ARCHIVE.find("[Event \"Second\"]"), ARCHIVE.find("[Event \"Third\"]") };
+	EXPECT_EQ(reader.GetIndex(), expected);
+
+	PGNGame game;
+	ASSERT_TRUE(reader.ReadGame(game));
+	EXPECT_EQ(game.GetTag("Event"), "Second");
+}
+
+TEST(TestPGNGameReader, Seeks_To_A_Game_By_Number)
+{
+	PGNGameReader reader;
+	ASSERT_TRUE(reader.Open(WriteArchive("seek.pgn")));
+
+	PGNGame game;
+	ASSERT_TRUE(reader.SeekGame(2));
+	ASSERT_TRUE(reader.ReadGame(game));
+	EXPECT_EQ(game.GetTag("Event"), "Third");
+
+	ASSERT_TRUE(reader.SeekGame(0));
+	ASSERT_TRUE(reader.ReadGame(game));
+	EXPECT_EQ(game.GetTag("Event"), "First");
+	EXPECT_EQ(reader.GetGameNumber(), 1u);
+
+	EXPECT_FALSE(reader.SeekGame(3));
+
+	// A saved index is used as it is //
+	PGNGameReader other;
+	ASSERT_TRUE(other.Open(testing::TempDir() + "seek.pgn"));
+	other.SetIndex(reader.GetIndex());
+
+	ASSERT_TRUE(other.SeekGame(1));
+	ASSERT_TRUE(other.ReadGame(game));
+	EXPECT_EQ(game.GetTag("Event"), "Second");
+}
+
+TEST(TestPGNGameReader, Missing_File_Does_Not_Open)
+{
+	PGNGameReader reader;
+	EXPECT_FALSE(reader.Open(testing::TempDir() + "missing.pgn"));
+
+	PGNGame game;
+	EXPECT_FALSE(reader.ReadGame(game));
+}
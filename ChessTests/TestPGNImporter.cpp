@@ -0,0 +1,155 @@
+#include "gtest/gtest.h"
+
+#include "PGNImporter.h"
+#include "PGNGameReader.h"
+
+#include <fstream>
+
+static const std::string DATABASE =
+	"[Event \"Legal\"]\n"
+	"\n"
+	"1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 4. Bxc6 dxc6 5. O-O 1-0\n"
+	"\n"
+	"[Event \"Illegal\"]\n"
+	"\n"
+	"1. d4 d5 2. Ke3 Nf6 0-1\n"
+	"\n"
+	"[Event \"Short\"]\n"
+	"{a comment} 1. c4 *\n";
+
+TEST(TestPGNImporter, Splits_At_The_Tags_Of_The_Next_Game)
+{
+	std::vector<std::string_view> games = PGNImporter::SplitGames(DATABASE);
+
+	ASSERT_EQ(games.size(), 3u);
+	EXPECT_EQ(games[0].substr(0, 16), "[Event \"Legal\"]\n");
+	EXPECT_EQ(games[1].substr(0, 18), "[Event \"Illegal\"]\n");
+	EXPECT_EQ(games[2], "[Event \"Short\"]\n{a comment} 1. c4 *\n");
+
+	EXPECT_TRUE(PGNImporter::SplitGames("").empty());
+	EXPECT_EQ(PGNImporter::SplitGames("1. e4 e5").size(), 1u);
+}
+
+TEST(TestPGNImporter, Splits_Like_The_Game_Reader)
+{
+	// A bracket inside a comment does not start a game, a missing blank line does not join two //
+	std::string text =
+		"[Event \"A\"]\n"
+		"1. e4 {a comment\n"
+		"[not a tag]} e5 *\n"
+		"[Event \"B\"]\n"
+		"1. d4 *\n";
+
+	std::vector<std::string_view> games = PGNImporter::SplitGames(text);
+
+	ASSERT_EQ(games.size(), 2u);
+	EXPECT_EQ(games[1], "[Event \"B\"]\n1. d4 *\n");
+	EXPECT_EQ(PGNGameReader::IndexText(text), PGNIndex({ 0, games[0].size() }));
+}
+
+TEST(TestPGNImporter, Splits_Games_Without_Tags_At_Their_Results)
+{
+	std::string text =
+		"1. e4 e5 (1... c5 *) 2. Nf3 1-0\n"
+		"\n"
+		"1. d4 d5 *\n";
+
+	std::vector<std::string_view> games = PGNImporter::SplitGames(text);
+
+	ASSERT_EQ(games.size(), 2u);
+	EXPECT_EQ(games[1], "1. d4 d5 *\n");
+
+	PGNImportResults results = PGNImporter().ImportText(text);
+	ASSERT_EQ(results.size(), 2u);
+	EXPECT_EQ(results[0].movesPlayed, 3);
+	EXPECT_EQ(results[1].movesPlayed, 2);
+	EXPECT_EQ(results[1].finalBoard[4][3], 'p');
+}
+
+TEST(TestPGNImporter, Reports_Every_Game_In_Order)
+{
+	PGNImporter importer;
+	importer.SetThreadCount(2);
+
+	PGNImportResults results = importer.ImportText(DATABASE);
+	ASSERT_EQ(results.size(), 3u);
+
+	EXPECT_TRUE(results[0].IsValid());
+	EXPECT_EQ(results[0].movesPlayed, 9);
+	EXPECT_EQ(results[0].finalBoard[7][6], 'k');
+	EXPECT_EQ(results[0].finalBoard[7][5], 'r');
+	EXPECT_EQ(results[0].turn, EColor::Black);
+
+	EXPECT_FALSE(results[1].IsValid());
+	EXPECT_EQ(results[1].tags, PGNTagList({ { "Event", "Illegal" } }));
+	EXPECT_EQ(results[1].movesPlayed, 2);
+	EXPECT_EQ(results[1].illegalMove, "Ke3");
+	EXPECT_EQ(results[1].finalBoard[3][3], 'P');
+	EXPECT_EQ(results[1].turn, EColor::White);
+
+	EXPECT_TRUE(results[2].IsValid());
+	EXPECT_EQ(results[2].finalBoard[4][2], 'p');
+}
+
+TEST(TestPGNImporter, Workers_Give_The_Same_Results)
+{
+	std::string database;
+	for (int i = 0; i < 50; i++)
+		database += DATABASE;
+
+	PGNImporter importer;
+	importer.SetThreadCount(1);
+	EXPECT_EQ(importer.GetThreadCount(), 1);
+
+	PGNImportResults serial = importer.ImportText(database);
+
+	importer.SetThreadCount(4);
+	EXPECT_EQ(importer.GetThreadCount(), 4);
+
+	PGNImportResults parallel = importer.ImportText(database);
+
+	ASSERT_EQ(serial.size(), 150u);
+	ASSERT_EQ(parallel.size(), serial.size());
+	for (std::size_t i = 0; i < serial.size(); i++)
+	{
+		EXPECT_EQ(parallel[i].tags, serial[i].tags);
+		EXPECT_EQ(parallel[i].movesPlayed, serial[i].movesPlayed);
+		EXPECT_EQ(parallel[i].illegalMove, serial[i].illegalMove);
+		EXPECT_EQ(parallel[i].finalBoard, serial[i].finalBoard);
+	}
+}
+
+TEST(TestPGNImporter, Check_That_Throws_Fails_Only_Its_Game)
+{
+	PGNImporter importer;
+	importer.SetThreadCount(2);
+	importer.SetGameCheck([](const ChessGame&, PGNImportResult& result)
+		{
+			if (!result.IsValid())
+				throw std::runtime_error("Illegal game");
+		});
+
+	PGNImportResults results = importer.ImportText(DATABASE);
+	ASSERT_EQ(results.size(), 3u);
+
+	EXPECT_TRUE(results[0].IsValid());
+	EXPECT_EQ(results[1].error, "Illegal game");
+	EXPECT_TRUE(results[2].IsValid());
+}
+
+TEST(TestPGNImporter, Imports_A_File)
+{
+	std::string fileName = testing::TempDir() + "database.pgn";
+	{
+		std::ofstream file(fileName, std::ios::binary);
+		file << DATABASE;
+	}
+
+	PGNImporter importer;
+	PGNImportResults results;
+
+	ASSERT_TRUE(importer.ImportFile(fileName, results));
+	EXPECT_EQ(results.size(), 3u);
+
+	EXPECT_FALSE(importer.ImportFile(testing::TempDir() + "missing.pgn", results));
+}
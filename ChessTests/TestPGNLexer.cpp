@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "PGNLexer.h"
+#include "PGNReader.h"
+
+#include <vector>
+
+static std::vector<PGNToken> Tokenize(std::string_view text)
+{
+	std::vector<PGNToken> tokens;
+
+	PGNLexer lexer(text);
+	PGNToken token;
+	while (lexer.Next(token))
+		tokens.push_back(token);
+
+	return tokens;
+}
+
+TEST(TestPGNLexer, Recognizes_Every_Token)
+{
+	std::string text =
+		"[Event \"Club \\\"Open\\\"\"]\n"
+		"[Site \"Here\"]\n"
+		"\n"
+		"1. e4 {best by test} e5 2. Nf3 $1 (2. f4 exf4) 2... Nc6 3. Bb5+ a6?! 4. O-O-O#\n"
+		"; rest of the line\n"
+		"1/2-1/2";
+
+	std::vector<PGNToken> tokens = Tokenize(text);
+
+	std::vector<EPGNToken> expectedTypes =
+	{
+		EPGNToken::TagPair, EPGNToken::TagPair,
+		EPGNToken::MoveNumber, EPGNToken::Move, EPGNToken::Comment, EPGNToken::Move,
+		EPGNToken::MoveNumber, EPGNToken::Move, EPGNToken::Annotation,
+		EPGNToken::VariationStart, EPGNToken::MoveNumber, EPGNToken::Move, EPGNToken::Move, EPGNToken::VariationEnd,
+		EPGNToken::MoveNumber, EPGNToken::Move,
+		EPGNToken::MoveNumber, EPGNToken::Move, EPGNToken::Check, EPGNToken::Move, EPGNToken::Annotation,
+		EPGNToken::MoveNumber, EPGNToken::Move, EPGNToken::Mate,
+		EPGNToken::Comment,
+		EPGNToken::Result
+	};
+
+	ASSERT_EQ(tokens.size(), expectedTypes.size());
+	for (std::size_t i = 0; i < tokens.size(); i++)
+	{
+		EXPECT_EQ(tokens[i].type, expectedTypes[i]) << "token " << i << ": " << tokens[i].text;
+	}
+
+	EXPECT_EQ(tokens[0].text, "Event");
+	EXPECT_EQ(tokens[0].value, "Club \\\"Open\\\"");
+	EXPECT_EQ(tokens[1].value, "Here");
+	EXPECT_EQ(tokens[2].text, "1");
+	EXPECT_EQ(tokens[4].text, "best by test");
+	EXPECT_EQ(tokens[8].text, "$1");
+	EXPECT_EQ(tokens[12].text, "exf4");
+	EXPECT_EQ(tokens[14].text, "2");
+	EXPECT_EQ(tokens[20].text, "?!");
+	EXPECT_EQ(tokens[22].text, "O-O-O");
+	EXPECT_EQ(tokens[24].text, " rest of the line");
+	EXPECT_EQ(tokens[25].text, "1/2-1/2");
+}
+
+TEST(TestPGNLexer, Tokens_Are_Slices_Of_The_Text)
+{
+	std::string text = "1. e4 {a comment} e5 *";
+
+	for (const PGNToken& token : Tokenize(text))
+	{
+		EXPECT_GE(token.text.data(), text.data());
+		EXPECT_LE(token.text.data() + token.text.size(), text.data() + text.size());
+	}
+}
+
+TEST(TestPGNLexer, Unterminated_Tokens_End_With_The_Text)
+{
+	std::vector<PGNToken> tokens = Tokenize("1. e4 {no end");
+
+	ASSERT_EQ(tokens.size(), 3u);
+	EXPECT_EQ(tokens[2].type, EPGNToken::Comment);
+	EXPECT_EQ(tokens[2].text, "no end");
+
+	tokens = Tokenize("[Event \"no end");
+	ASSERT_EQ(tokens.size(), 1u);
+	EXPECT_EQ(tokens[0].type, EPGNToken::TagPair);
+	EXPECT_EQ(tokens[0].value, "no end");
+}
+
+TEST(TestPGNLexer, Reader_Keeps_The_Main_Line)
+{
+	PGNReader reader;
+	EXPECT_TRUE(reader.LoadFromString("[White \"A\"] 1. e4 e5 (1... c5 2. Nf3) 2. Nf3 {develops} Nc6 3. Bb5 a6 4. Bxc6 dxc6 5. O-O 1-0 6. a3"));
+
+	StringMoveList expected = { "e4", "e5", "Nf3", "Nc6", "Bb5", "a6", "Bc6", "dc6", "0-0" };
+	EXPECT_EQ(reader.GetMoves(), expected);
+}
+
+TEST(TestPGNLexer, Game_Format_Reads_Back)
+{
+	ChessGame game;
+	game.MakeMove(Position(6, 4), Position(4, 4));
+	game.MakeMove(Position(1, 3), Position(3, 3));
+	game.MakeMove(Position(4, 4), Position(3, 3));
+	game.MakeMove(Position(0, 3), Position(3, 3));
+	game.MakeMove(Position(7, 6), Position(5, 5));
+
+	PGNReader reader;
+	EXPECT_TRUE(reader.LoadFromString(game.GetFormat(EFormat::Pgn)));
+
+	StringMoveList expected = { "e4", "d5", "ed5", "Qd5", "Nf3" };
+	EXPECT_EQ(reader.GetMoves(), expected);
+}
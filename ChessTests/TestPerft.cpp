@@ -0,0 +1,236 @@
+#include "gtest/gtest.h"
+
+#include "Perft.h"
+
+// Reference node counts of the standard perft positions //
+
+TEST(Perft, InitialPosition)
+{
+	// rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -
+
+	CharBoard board =
+	{
+		'R', 'H', 'B', 'Q', 'K', 'B', 'H', 'R',
+		'P', 'P', 'P', 'P', 'P', 'P', 'P', 'P',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		'p', 'p', 'p', 'p', 'p', 'p', 'p', 'p',
+		'r', 'h', 'b', 'q', 'k', 'b', 'h', 'r'
+	};
+
+	Perft perft(board, EColor::White, { true, true, true, true });
+
+	EXPECT_EQ(perft.Run(1), 20);
+	EXPECT_EQ(perft.Run(2), 400);
+	EXPECT_EQ(perft.Run(3), 8902);
+	EXPECT_EQ(perft.Run(4), 197281);
+}
+
+TEST(Perft, Kiwipete)
+{
+	// r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -
+
+	CharBoard board =
+	{
+		'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',
+		'P', ' ', 'P', 'P', 'Q', 'P', 'B', ' ',
+		'B', 'H', ' ', ' ', 'P', 'H', 'P', ' ',
+		' ', ' ', ' ', 'p', 'h', ' ', ' ', ' ',
+		' ', 'P', ' ', ' ', 'p', ' ', ' ', ' ',
+		' ', ' ', 'h', ' ', ' ', 'q', ' ', 'P',
+		'p', 'p', 'p', 'b', 'b', 'p', 'p', 'p',
+		'r', ' ', ' ', ' ', 'k', ' ', ' ', 'r'
+	};
+
+	Perft perft(board, EColor::White, { true, true, true, true });
+
+	EXPECT_EQ(perft.Run(1), 48);
+	EXPECT_EQ(perft.Run(2), 2039);
+	EXPECT_EQ(perft.Run(3), 97862);
+}
+
+TEST(Perft, RookEndgame)
+{
+	// 8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -
+
+	CharBoard board =
+	{
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', 'P', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', 'P', ' ', ' ', ' ', ' ',
+		'k', 'p', ' ', ' ', ' ', ' ', ' ', 'R',
+		' ', 'r', ' ', ' ', ' ', 'P', ' ', 'K',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', 'p', ' ', 'p', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' '
+	};
+
+	Perft perft(board, EColor::White, { false, false, false, false });
+
+	EXPECT_EQ(perft.Run(1), 14);
+	EXPECT_EQ(perft.Run(2), 191);
+	EXPECT_EQ(perft.Run(3), 2812);
+	EXPECT_EQ(perft.Run(4), 43238);
+}
+
+TEST(Perft, PromotionsAndCastles)
+{
+	// r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq -
+
+	CharBoard board =
+	{
+		'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',
+		'p', 'P', 'P', 'P', ' ', 'P', 'P', 'P',
+		' ', 'B', ' ', ' ', ' ', 'H', 'B', 'h',
+		'H', 'p', ' ', ' ', ' ', ' ', ' ', ' ',
+		'b', 'b', 'p', ' ', 'p', ' ', ' ', ' ',
+		'Q', ' ', ' ', ' ', ' ', 'h', ' ', ' ',
+		'p', 'P', ' ', 'p', ' ', ' ', 'p', 'p',
+		'r', ' ', ' ', 'q', ' ', 'r', 'k', ' '
+	};
+
+	Perft perft(board, EColor::White, { false, false, true, true });
+
+	EXPECT_EQ(perft.Run(1), 6);
+	EXPECT_EQ(perft.Run(2), 264);
+	EXPECT_EQ(perft.Run(3), 9467);
+}
+
+TEST(Perft, PromotionWithDiscoveredCheck)
+{
+	// rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -
+
+	CharBoard board =
+	{
+		'R', 'H', 'B', 'Q', ' ', 'K', ' ', 'R',
+		'P', 'P', ' ', 'p', 'B', 'P', 'P', 'P',
+		' ', ' ', 'P', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', 'b', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		'p', 'p', 'p', ' ', 'h', 'H', 'p', 'p',
+		'r', 'h', 'b', 'q', 'k', ' ', ' ', 'r'
+	};
+
+	Perft perft(board, EColor::White, { true, true, false, false });
+
+	EXPECT_EQ(perft.Run(1), 44);
+	EXPECT_EQ(perft.Run(2), 1486);
+	EXPECT_EQ(perft.Run(3), 62379);
+}
+
+TEST(Perft, MiddleGame)
+{
+	// r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - -
+
+	CharBoard board =
+	{
+		'R', ' ', ' ', ' ', ' ', 'R', 'K', ' ',
+		' ', 'P', 'P', ' ', 'Q', 'P', 'P', 'P',
+		'P', ' ', 'H', 'P', ' ', 'H', ' ', ' ',
+		' ', ' ', 'B', ' ', 'P', ' ', 'b', ' ',
+		' ', ' ', 'b', ' ', 'p', ' ', 'B', ' ',
+		'p', ' ', 'h', 'p', ' ', 'h', ' ', ' ',
+		' ', 'p', 'p', ' ', 'q', 'p', 'p', 'p',
+		'r', ' ', ' ', ' ', ' ', 'r', 'k', ' '
+	};
+
+	Perft perft(board, EColor::White, { false, false, false, false });
+
+	EXPECT_EQ(perft.Run(1), 46);
+	EXPECT_EQ(perft.Run(2), 2079);
+	EXPECT_EQ(perft.Run(3), 89890);
+}
+
+TEST(Perft, DivideSumsToRun)
+{
+	CharBoard board =
+	{
+		'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',
+		'P', ' ', 'P', 'P', 'Q', 'P', 'B', ' ',
+		'B', 'H', ' ', ' ', 'P', 'H', 'P', ' ',
+		' ', ' ', ' ', 'p', 'h', ' ', ' ', ' ',
+		' ', 'P', ' ', ' ', 'p', ' ', ' ', ' ',
+		' ', ' ', 'h', ' ', ' ', 'q', ' ', 'P',
+		'p', 'p', 'p', 'b', 'b', 'p', 'p', 'p',
+		'r', ' ', ' ', ' ', 'k', ' ', ' ', 'r'
+	};
+
+	Perft perft(board, EColor::White, { true, true, true, true });
+
+	PerftDivideList divide = perft.Divide(2);
+
+	std::uint64_t nodes = 0;
+	for (const auto& moveNodes : divide)
+	{
+		nodes += moveNodes.second;
+	}
+
+	EXPECT_EQ(divide.size(), 48);
+	EXPECT_EQ(nodes, 2039);
+}
+
+static std::uint64_t CountNodes(BitboardPosition& position, int depth)
+{
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+	if (depth == 1)
+		return moves.size();
+
+	std::uint64_t nodes = 0;
+	for (const auto& move : moves)
+	{
+		UndoInfo undo = position.MakeMove(move);
+		nodes += CountNodes(position, depth - 1);
+		position.UnmakeMove(undo);
+	}
+	return nodes;
+}
+
+TEST(Perft, EnPassantSquareOfTheBoard)
+{
+	// rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6, after 1. e4 d5 2. e5 f5
+
+	CharBoard board =
+	{
+		'R', 'H', 'B', 'Q', 'K', 'B', 'H', 'R',
+		'P', 'P', 'P', ' ', 'P', ' ', 'P', 'P',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', 'P', 'p', 'P', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+		'p', 'p', 'p', 'p', ' ', 'p', 'p', 'p',
+		'r', 'h', 'b', 'q', 'k', 'b', 'h', 'r'
+	};
+
+	// The same position reached by playing the moves //
+	BitboardPosition played(board, EColor::White, { true, true, true, true });
+	{
+		CharBoard start =
+		{
+			'R', 'H', 'B', 'Q', 'K', 'B', 'H', 'R',
+			'P', 'P', 'P', 'P', 'P', 'P', 'P', 'P',
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+			'p', 'p', 'p', 'p', 'p', 'p', 'p', 'p',
+			'r', 'h', 'b', 'q', 'k', 'b', 'h', 'r'
+		};
+		played = BitboardPosition(start, EColor::White, { true, true, true, true });
+		played.MakeMove(52, 36);
+		played.MakeMove(11, 27);
+		played.MakeMove(36, 28);
+		played.MakeMove(13, 29);
+	}
+
+	Perft perft(board, EColor::White, { true, true, true, true }, 21);
+	Perft withoutEnPassant(board, EColor::White, { true, true, true, true });
+
+	EXPECT_EQ(perft.Run(1), CountNodes(played, 1));
+	EXPECT_EQ(perft.Run(3), CountNodes(played, 3));
+	EXPECT_EQ(perft.Run(1), withoutEnPassant.Run(1) + 1);
+	EXPECT_EQ(BitboardPosition(board, EColor::White, { true, true, true, true }, 21).GetKey(), played.GetKey());
+}
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+
+#include "Bitboard.h"
+
+#include <vector>
+
+// Walks every direction square by square, the way the piece patterns do //
+static Bitboard WalkAttacks(int square, Bitboard occupancy, const std::vector<Position>& directions)
+{
+	Position pos = ToPosition(square);
+	Bitboard attacks = 0;
+
+	for (const auto& direction : directions)
+	{
+		for (int row = pos.row + direction.row, col = pos.col + direction.col
+			; row >= 0 && row < 8 && col >= 0 && col < 8
+			; row += direction.row, col += direction.col)
+		{
+			attacks |= SquareBB(row * 8 + col);
+			if (occupancy & SquareBB(row * 8 + col))
+				break;
+		}
+	}
+	return attacks;
+}
+
+static const std::vector<Position> ROOK_DIRECTIONS = { Position(-1, 0), Position(1, 0), Position(0, -1), Position(0, 1) };
+static const std::vector<Position> BISHOP_DIRECTIONS = { Position(-1, -1), Position(-1, 1), Position(1, -1), Position(1, 1) };
+
+TEST(TestSlidingAttacks, Lookup_Matches_Ray_Walk)
+{
+	Bitboard state = 0x123456789ABCDEF;
+
+	for (int i = 0; i < 2000; i++)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		// Sparse and dense boards alike //
+		Bitboard occupancy = i % 2 ? state : state & (state >> 17) & (state >> 31);
+
+		for (int square = 0; square < 64; square++)
+		{
+			ASSERT_EQ(Bitboards::RookAttacks(square, occupancy), WalkAttacks(square, occupancy, ROOK_DIRECTIONS));
+			ASSERT_EQ(Bitboards::BishopAttacks(square, occupancy), WalkAttacks(square, occupancy, BISHOP_DIRECTIONS));
+		}
+	}
+}
+
+TEST(TestSlidingAttacks, Empty_Board_Attacks)
+{
+	EXPECT_EQ(PopCount(Bitboards::RookAttacks(ToSquare(Position(4, 4)), 0)), 14);
+	EXPECT_EQ(PopCount(Bitboards::BishopAttacks(ToSquare(Position(4, 4)), 0)), 13);
+	EXPECT_EQ(PopCount(Bitboards::BishopAttacks(ToSquare(Position(0, 0)), 0)), 7);
+	EXPECT_EQ(PopCount(Bitboards::QueenAttacks(ToSquare(Position(7, 7)), 0)), 21);
+}
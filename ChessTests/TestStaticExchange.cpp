@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "BitboardPosition.h"
+#include "ChessException.h"
+
+static int Exchange(const CharBoard& board, Position from, Position to, EMoveFlag flag = EMoveFlag::Capture)
+{
+	BitboardPosition position(board, EColor::White, { false, false, false, false });
+	return position.StaticExchange(Move(ToSquare(from), ToSquare(to), flag));
+}
+
+TEST(TestStaticExchange, Undefended_Piece_Is_Won)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', 'K',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', 'H', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', 'r', ' ', ' ', ' ',   // 6
+			'k', ' ', ' ', ' ', ' ', ' ', ' ', ' '    // 7
+	};
+
+	EXPECT_EQ(Exchange(board, Position(6, 4), Position(3, 4)), 320);
+}
+
+TEST(TestStaticExchange, Queen_Taking_A_Defended_Pawn_Is_Lost)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', 'K',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			'P', ' ', ' ', 'P', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', 'P', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', 'q', ' ', ' ', ' ',   // 6
+			'k', ' ', ' ', ' ', ' ', ' ', ' ', ' '    // 7
+	};
+
+	EXPECT_EQ(Exchange(board, Position(6, 4), Position(3, 4)), 100 - 900);
+
+	// Moving the queen where a pawn takes it loses it without taking anything //
+	EXPECT_EQ(Exchange(board, Position(6, 4), Position(3, 1), EMoveFlag::Quiet), -900);
+}
+
+TEST(TestStaticExchange, Rook_Behind_Rook_Joins_The_Exchange)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', 'R', ' ', ' ', 'K',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', 'P', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', 'r', ' ', ' ', ' ',   // 6
+			'k', ' ', ' ', ' ', 'r', ' ', ' ', ' '    // 7
+	};
+
+	// Pawn, rook, rook: the second white rook takes back last //
+	EXPECT_EQ(Exchange(board, Position(6, 4), Position(3, 4)), 100);
+
+	board[7][4] = ' ';
+	EXPECT_EQ(Exchange(board, Position(6, 4), Position(3, 4)), 100 - 500);
+}
+
+TEST(TestStaticExchange, Queen_Behind_Bishop_Joins_The_Exchange)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', 'K',   // 0
+			' ', ' ', 'P', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', 'H', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', 'b', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', 'q',   // 6
+			'k', ' ', ' ', ' ', ' ', ' ', ' ', ' '    // 7
+	};
+
+	// Bishop takes horse, pawn takes bishop, queen takes pawn //
+	EXPECT_EQ(Exchange(board, Position(5, 6), Position(2, 3)), 320 - 330 + 100);
+
+	board[6][7] = ' ';
+	EXPECT_EQ(Exchange(board, Position(5, 6), Position(2, 3)), 320 - 330);
+}
+
+TEST(TestStaticExchange, King_Does_Not_Take_A_Defended_Piece)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', 'K', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', 'P', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', 'h', ' ',   // 3
+			' ', ' ', 'b', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			'k', ' ', ' ', ' ', ' ', ' ', ' ', ' '    // 7
+	};
+
+	EXPECT_EQ(Exchange(board, Position(3, 6), Position(1, 5)), 100);
+
+	board[4][2] = ' ';
+	EXPECT_EQ(Exchange(board, Position(3, 6), Position(1, 5)), 100 - 320);
+}
+
+TEST(TestStaticExchange, Game_Checks_The_Move)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			' ', ' ', ' ', ' ', 'K', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', 'P', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', 'h', ' ',   // 3
+			' ', ' ', 'b', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			'k', ' ', ' ', ' ', ' ', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White, { false, false, false, false });
+
+	EXPECT_EQ(game.StaticExchange(Position(3, 6), Position(1, 5)), 100);
+	EXPECT_THROW(game.StaticExchange(Position(3, 6), Position(3, 5)), NotInPossibleMovesException);
+	EXPECT_THROW(game.StaticExchange(Position(8, 6), Position(1, 5)), InvalidBoardPositionException);
+}
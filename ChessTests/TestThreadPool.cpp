@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+
+#include "ThreadPool.h"
+
+#include <atomic>
+
+TEST(TestThreadPool, Every_Thread_Runs_Every_Task)
+{
+	ThreadPool pool;
+	pool.Resize(4);
+
+	std::atomic<int> indexSum(0);
+	std::atomic<int> runs(0);
+
+	for (int i = 0; i < 50; i++)
+	{
+		pool.Start([&](int index)
+			{
+				indexSum += index;
+				runs++;
+			});
+		pool.Wait();
+	}
+
+	EXPECT_EQ(runs, 200);
+	EXPECT_EQ(indexSum, 50 * (0 + 1 + 2 + 3));
+}
+
+TEST(TestThreadPool, Resize_Keeps_Pool_Usable)
+{
+	ThreadPool pool;
+
+	std::atomic<int> runs(0);
+
+	pool.Resize(2);
+	pool.Start([&](int) { runs++; });
+	pool.Wait();
+
+	pool.Resize(3);
+	pool.Start([&](int) { runs++; });
+	pool.Wait();
+
+	pool.Resize(0);
+	pool.Start([&](int) { runs++; });
+	pool.Wait();
+
+	EXPECT_EQ(pool.GetSize(), 0);
+	EXPECT_EQ(runs, 5);
+}
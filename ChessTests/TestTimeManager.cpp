@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "IChessEngine.h"
+#include "TimeManager.h"
+
+#include <chrono>
+
+static SearchLimits ClockLimits(int remainingTime, int increment = 0)
+{
+	SearchLimits limits;
+	limits.remainingTime = remainingTime;
+	limits.increment = increment;
+	return limits;
+}
+
+static const CharBoard FORCED_MOVE_BOARD =
+{
+	//   0    1    2    3    4    5    6    7
+
+		'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+		' ', ' ', ' ', ' ', ' ', ' ', ' ', 'p',   // 6
+		'R', ' ', ' ', ' ', ' ', ' ', ' ', 'k'    // 7
+};
+
+TEST(TestTimeManager, Clock_Is_Planned_For_The_Rest_Of_The_Game)
+{
+	TimeManager timeManager(ClockLimits(60000), 20);
+
+	EXPECT_GT(timeManager.GetSoftLimit(), 0);
+	EXPECT_LT(timeManager.GetSoftLimit(), timeManager.GetHardLimit());
+	EXPECT_LT(timeManager.GetHardLimit(), 60000 / 4);
+
+	// The increment comes back after the move, so most of it is spent //
+	TimeManager withIncrement(ClockLimits(60000, 2000), 20);
+
+	EXPECT_GT(withIncrement.GetSoftLimit(), timeManager.GetSoftLimit() + 1000);
+	EXPECT_GT(withIncrement.GetHardLimit(), timeManager.GetHardLimit());
+}
+
+TEST(TestTimeManager, Low_Clock_Keeps_A_Margin)
+{
+	for (int remainingTime : { 1, 30, 100, 500 })
+	{
+		TimeManager timeManager(ClockLimits(remainingTime, 1000), 20);
+
+		EXPECT_GE(timeManager.GetHardLimit(), 1);
+		EXPECT_LT(timeManager.GetHardLimit(), std::max(remainingTime - 40, 2));
+		EXPECT_LE(timeManager.GetSoftLimit(), timeManager.GetHardLimit());
+	}
+}
+
+TEST(TestTimeManager, Stable_Best_Move_Stops_Earlier_And_Score_Drop_Extends)
+{
+	TimeManager timeManager(ClockLimits(600000), 20);
+	timeManager.Start();
+
+	Move bestMove(ToSquare(Position(6, 4)), ToSquare(Position(4, 4)), EMoveFlag::DoublePawnPush);
+	Move otherMove(ToSquare(Position(6, 3)), ToSquare(Position(4, 3)), EMoveFlag::DoublePawnPush);
+
+	EXPECT_FALSE(timeManager.ShouldStopIterating(bestMove, 20));
+	int unstableLimit = timeManager.GetSoftLimit();
+
+	for (int i = 0; i < 4; i++)
+		EXPECT_FALSE(timeManager.ShouldStopIterating(bestMove, 20));
+	int stableLimit = timeManager.GetSoftLimit();
+
+	EXPECT_LT(stableLimit, unstableLimit);
+
+	EXPECT_FALSE(timeManager.ShouldStopIterating(bestMove, -100));
+	EXPECT_GT(timeManager.GetSoftLimit(), stableLimit);
+
+	// A new best move starts over //
+	EXPECT_FALSE(timeManager.ShouldStopIterating(otherMove, -100));
+	EXPECT_EQ(timeManager.GetSoftLimit(), unstableLimit);
+}
+
+TEST(TestTimeManager, Forced_Move_Is_Played_After_One_Iteration)
+{
+	BitboardPosition position(FORCED_MOVE_BOARD, EColor::White, { false, false, false, false });
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+	ASSERT_EQ(moves.size(), 1);
+
+	TimeManager timeManager(ClockLimits(60000), moves.size());
+	timeManager.Start();
+	EXPECT_TRUE(timeManager.ShouldStopIterating(moves[0], 0));
+
+	// Without a time limit the search goes on to its depth //
+	SearchLimits limits;
+	limits.depth = 5;
+	TimeManager depthOnly(limits, moves.size());
+	depthOnly.Start();
+	EXPECT_FALSE(depthOnly.ShouldStopIterating(moves[0], 0));
+
+	ChessGame game(FORCED_MOVE_BOARD, EColor::White, { false, false, false, false });
+	SearchResult result = IChessEngine::CreateEngine()->Search(game, ClockLimits(60000));
+
+	EXPECT_EQ(result.depth, 1);
+	EXPECT_EQ(result.bestMove.to, Position(6, 6));
+}
+
+TEST(TestTimeManager, Engine_Search_Stays_Within_The_Clock)
+{
+	ChessGame game;
+
+	auto start = std::chrono::steady_clock::now();
+	SearchResult result = IChessEngine::CreateEngine()->Search(game, ClockLimits(300));
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+	EXPECT_GE(result.depth, 1);
+	EXPECT_LT(elapsed.count(), 300);
+}
+
+TEST(TestTimeManager, Clock_Limits_Read_The_Timed_Mode)
+{
+	ChessGame game;
+	game.EnableTimedMode(60);
+	game.SetIncrement(2000);
+
+	// White gets the increment after the move, Black's clock runs //
+	game.MakeMove(Position(6, 4), Position(4, 4));
+
+	SearchLimits white = IChessEngine::GetClockLimits(game, EColor::White);
+	SearchLimits black = IChessEngine::GetClockLimits(game, EColor::Black);
+
+	EXPECT_GT(white.remainingTime, 60000);
+	EXPECT_LE(black.remainingTime, 60000);
+	EXPECT_EQ(white.increment, 2000);
+}
+
+TEST(TestTimeManager, Undo_Takes_The_Increment_Back)
+{
+	ChessGame game;
+	game.EnableTimedMode(60);
+	game.SetIncrement(2000);
+
+	// Paused, so only the increments change the clocks //
+	game.Pause();
+	int white = game.GetRemainingTime(EColor::White);
+	int black = game.GetRemainingTime(EColor::Black);
+
+	for (int i = 0; i < 2; i++)
+	{
+		game.MakeMove(Position(6, 4), Position(4, 4));
+		EXPECT_EQ(game.GetRemainingTime(EColor::White), white + 2000);
+
+		game.UndoMove();
+		EXPECT_EQ(game.GetRemainingTime(EColor::White), white);
+		EXPECT_EQ(game.GetRemainingTime(EColor::Black), black);
+	}
+}
@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+
+#include "TranspositionTable.h"
+#include "ChessGame.h"
+#include "IChessEngine.h"
+
+TEST(TestTranspositionTable, Size_Is_Largest_Power_Of_Two)
+{
+	TranspositionTable table(1);
+
+	EXPECT_EQ(table.GetEntryCount(), 1024 * 1024 / 16);
+
+	table.Resize(3);
+
+	EXPECT_EQ(table.GetEntryCount(), 2 * 1024 * 1024 / 16);
+}
+
+TEST(TestTranspositionTable, Stored_Data_Is_Found)
+{
+	TranspositionTable table(1);
+
+	Move move(52, 36, EMoveFlag::DoublePawnPush);
+	table.Store(0x1234567887654321, move, -250, 7, EBound::Lower);
+
+	TranspositionData data;
+	ASSERT_TRUE(table.Probe(0x1234567887654321, data));
+	EXPECT_EQ(data.move, move);
+	EXPECT_EQ(data.score, -250);
+	EXPECT_EQ(data.depth, 7);
+	EXPECT_EQ(data.bound, EBound::Lower);
+
+	// Same entry, different key //
+	EXPECT_FALSE(table.Probe(0x1234567887654321 ^ (std::uint64_t(1) << 63), data));
+
+	table.Clear();
+
+	EXPECT_FALSE(table.Probe(0x1234567887654321, data));
+}
+
+TEST(TestTranspositionTable, Shallower_Result_Keeps_Deeper_One)
+{
+	TranspositionTable table(1);
+
+	table.Store(42, Move(1, 2), 10, 8, EBound::Lower);
+	table.Store(42, Move(), 20, 3, EBound::Upper);
+
+	TranspositionData data;
+	ASSERT_TRUE(table.Probe(42, data));
+	EXPECT_EQ(data.depth, 8);
+	EXPECT_EQ(data.score, 10);
+
+	// A new search replaces results of the earlier ones, keeping the move //
+	table.NewSearch();
+	table.Store(42, Move(), 20, 3, EBound::Upper);
+
+	ASSERT_TRUE(table.Probe(42, data));
+	EXPECT_EQ(data.depth, 3);
+	EXPECT_EQ(data.move, Move(1, 2));
+}
+
+TEST(TestTranspositionTable, Hashfull_Counts_Current_Search)
+{
+	TranspositionTable table(1);
+
+	EXPECT_EQ(table.GetHashfull(), 0);
+
+	for (std::uint64_t key = 0; key < 500; key++)
+	{
+		table.Store(key, Move(), 0, 1, EBound::Exact);
+	}
+
+	EXPECT_EQ(table.GetHashfull(), 500);
+
+	table.NewSearch();
+
+	EXPECT_EQ(table.GetHashfull(), 0);
+}
+
+TEST(TestTranspositionTable, Engine_Reuses_Earlier_Results)
+{
+	ChessGame game;
+	IChessEnginePtr engine = IChessEngine::CreateEngine();
+
+	SearchLimits limits;
+	limits.depth = 5;
+
+	SearchResult first = engine->Search(game, limits);
+
+	EXPECT_GT(engine->GetHashfull(), 0);
+
+	SearchResult second = engine->Search(game, limits);
+
+	EXPECT_LT(second.nodes, first.nodes);
+
+	engine->ClearHash();
+
+	EXPECT_EQ(engine->GetHashfull(), 0);
+}
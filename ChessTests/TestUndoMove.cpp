@@ -0,0 +1,221 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "ChessException.h"
+
+TEST(TestUndoMove, Undo_Without_Moves_Throws)
+{
+	ChessGame game;
+
+	EXPECT_THROW(game.UndoMove(), InvalidStateException);
+}
+
+TEST(TestUndoMove, Undo_Restores_Initial_Position)
+{
+	ChessGame game;
+
+	CharBoard initialBoard = game.GetBoardAtIndex(0);
+	IPiecePtr pawn = game.GetIPiecePtr(Position(6, 4));
+
+	game.MakeMove(Position(6, 4), Position(4, 4));
+	game.UndoMove();
+
+	EXPECT_EQ(game.GetCurrentPlayer(), EColor::White);
+	EXPECT_EQ(game.GetNumberOfMoves(), 1);
+	EXPECT_EQ(game.GetBoardAtIndex(0), initialBoard);
+	EXPECT_EQ(game.GetIPiecePtr(Position(6, 4)), pawn);
+	EXPECT_EQ(game.GetIPiecePtr(Position(4, 4)), nullptr);
+	EXPECT_EQ(game.GetFormat(EFormat::Pgn), "");
+}
+
+TEST(TestUndoMove, Undo_Restores_PGN_Of_Previous_Moves)
+{
+	ChessGame game;
+
+	game.MakeMove(Position(6, 4), Position(4, 4));
+	game.MakeMove(Position(1, 4), Position(3, 4));
+
+	std::string format = game.GetFormat(EFormat::Pgn);
+
+	game.MakeMove(Position(7, 6), Position(5, 5));
+	game.UndoMove();
+
+	EXPECT_EQ(game.GetFormat(EFormat::Pgn), format);
+
+	game.MakeMove(Position(7, 6), Position(5, 5));
+
+	EXPECT_EQ(game.GetFormat(EFormat::Pgn), format + "2. Nf3 ");
+}
+
+TEST(TestUndoMove, Undo_Capture_Restores_Captured_Piece)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', 'Q', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', 'r', 'k', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White);
+
+	IPiecePtr queen = game.GetIPiecePtr(Position(2, 3));
+
+	game.MakeMove(Position(7, 3), Position(2, 3));
+
+	EXPECT_EQ(game.GetCapturedPieces(EColor::Black).size(), 1);
+
+	game.UndoMove();
+
+	EXPECT_EQ(game.GetIPiecePtr(Position(2, 3)), queen);
+	EXPECT_EQ(game.GetIPiecePtr(Position(7, 3))->GetType(), EType::Rook);
+	EXPECT_TRUE(game.GetCapturedPieces(EColor::Black).empty());
+	EXPECT_EQ(game.GetPossibleMoves(Position(7, 3)).size(), 8);
+}
+
+TEST(TestUndoMove, Undo_Castle_Restores_Rook_And_Castle_Rights)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			'r', ' ', ' ', ' ', 'k', ' ', ' ', 'r'    // 7
+	};
+
+	ChessGame game(board, EColor::White);
+
+	game.MakeMove(Position(7, 4), Position(7, 2));
+
+	EXPECT_FALSE(game.IsCastlingAvailable(EColor::White, ESide::Queenside));
+	EXPECT_EQ(game.GetIPiecePtr(Position(7, 3))->GetType(), EType::Rook);
+
+	game.UndoMove();
+
+	EXPECT_TRUE(game.IsCastlingAvailable(EColor::White, ESide::Queenside));
+	EXPECT_TRUE(game.IsCastlingAvailable(EColor::White, ESide::Kingside));
+	EXPECT_EQ(game.GetIPiecePtr(Position(7, 0))->GetType(), EType::Rook);
+	EXPECT_EQ(game.GetIPiecePtr(Position(7, 4))->GetType(), EType::King);
+	EXPECT_EQ(game.GetIPiecePtr(Position(7, 2)), nullptr);
+	EXPECT_EQ(game.GetIPiecePtr(Position(7, 3)), nullptr);
+	EXPECT_EQ(game.GetCurrentPlayer(), EColor::White);
+}
+
+TEST(TestUndoMove, Undo_En_Passant_Restores_Captured_Pawn)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', 'P', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', 'p', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::Black, { false, false, false, false });
+
+	game.MakeMove(Position(1, 3), Position(3, 3));
+	game.MakeMove(Position(3, 4), Position(2, 3));
+
+	EXPECT_EQ(game.GetIPiecePtr(Position(3, 3)), nullptr);
+
+	game.UndoMove();
+
+	EXPECT_EQ(game.GetIPiecePtr(Position(3, 3))->GetType(), EType::Pawn);
+	EXPECT_EQ(game.GetIPiecePtr(Position(3, 4))->GetType(), EType::Pawn);
+	EXPECT_EQ(game.GetIPiecePtr(Position(2, 3)), nullptr);
+
+	PositionList possibleMoves = game.GetPossibleMoves(Position(3, 4));
+	EXPECT_NE(std::find(possibleMoves.begin(), possibleMoves.end(), Position(2, 3)), possibleMoves.end());
+}
+
+TEST(TestUndoMove, Undo_Upgrade_Restores_Pawn)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', 'p', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White);
+
+	IPiecePtr pawn = game.GetIPiecePtr(Position(1, 6));
+
+	game.MakeMove(Position(1, 6), Position(0, 6), false, EType::Queen);
+
+	EXPECT_EQ(game.GetIPiecePtr(Position(0, 6))->GetType(), EType::Queen);
+
+	game.UndoMove();
+
+	EXPECT_EQ(game.GetIPiecePtr(Position(1, 6)), pawn);
+	EXPECT_EQ(game.GetIPiecePtr(Position(0, 6)), nullptr);
+	EXPECT_FALSE(game.IsCheckState());
+}
+
+TEST(TestUndoMove, Undo_Upgrade_Restores_Position_Key)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', 'p', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', 'k', ' ', ' ', ' '    // 7
+	};
+
+	ChessGame game(board, EColor::White);
+	std::uint64_t key = game.GetPositionKey();
+
+	game.MakeMove(Position(1, 6), Position(0, 6), false, EType::Queen);
+
+	EXPECT_EQ(game.GetKeysSinceLastIrreversibleMove().back(), game.GetPositionKey());
+	EXPECT_EQ(game.GetBoardAtIndex(1)[0][6], 'q');
+
+	game.UndoMove();
+
+	EXPECT_EQ(game.GetPositionKey(), key);
+	EXPECT_EQ(game.GetKeysSinceLastIrreversibleMove().back(), key);
+
+	// The upgrade chosen later by the player replaces the pawn of the saved position //
+	game.MakeMove(Position(1, 6), Position(0, 6));
+	EXPECT_EQ(game.GetBoardAtIndex(1)[0][6], 'p');
+
+	game.UpgradePawn(EType::Rook);
+	EXPECT_EQ(game.GetKeysSinceLastIrreversibleMove().back(), game.GetPositionKey());
+	EXPECT_EQ(game.GetBoardAtIndex(1)[0][6], 'r');
+
+	game.UndoMove();
+
+	EXPECT_EQ(game.GetPositionKey(), key);
+	EXPECT_EQ(game.GetKeysSinceLastIrreversibleMove().back(), key);
+}
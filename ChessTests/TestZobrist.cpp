@@ -0,0 +1,146 @@
+#include "gtest/gtest.h"
+
+#include "ChessGame.h"
+#include "BitboardPosition.h"
+
+static const CharBoard DEFAULT_BOARD =
+{
+	'R', 'H', 'B', 'Q', 'K', 'B', 'H', 'R',
+	'P', 'P', 'P', 'P', 'P', 'P', 'P', 'P',
+	' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+	' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+	' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+	' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+	'p', 'p', 'p', 'p', 'p', 'p', 'p', 'p',
+	'r', 'h', 'b', 'q', 'k', 'b', 'h', 'r'
+};
+
+static void CheckKeys(BitboardPosition& position, int depth)
+{
+	ASSERT_EQ(position.GetKey(), position.ComputeKey());
+
+	if (depth == 0)
+		return;
+
+	FixedMoveList moves;
+	position.GenerateLegalMoves(moves);
+
+	for (const auto& move : moves)
+	{
+		std::uint64_t key = position.GetKey();
+
+		UndoInfo undo = position.MakeMove(move);
+		CheckKeys(position, depth - 1);
+		position.UnmakeMove(undo);
+
+		ASSERT_EQ(position.GetKey(), key);
+	}
+}
+
+TEST(TestZobrist, Incremental_Key_Matches_Computed_Key)
+{
+	// Kiwipete: castles, en passant and promotions within three plies //
+
+	CharBoard board =
+	{
+		'R', ' ', ' ', ' ', 'K', ' ', ' ', 'R',
+		'P', ' ', 'P', 'P', 'Q', 'P', 'B', ' ',
+		'B', 'H', ' ', ' ', 'P', 'H', 'P', ' ',
+		' ', ' ', ' ', 'p', 'h', ' ', ' ', ' ',
+		' ', 'P', ' ', ' ', 'p', ' ', ' ', ' ',
+		' ', ' ', 'h', ' ', ' ', 'q', ' ', 'P',
+		'p', 'p', 'p', 'b', 'b', 'p', 'p', 'p',
+		'r', ' ', ' ', ' ', 'k', ' ', ' ', 'r'
+	};
+
+	BitboardPosition position(board, EColor::White, { true, true, true, true });
+
+	CheckKeys(position, 3);
+}
+
+TEST(TestZobrist, Key_Depends_On_Side_To_Move_And_Castle_Rights)
+{
+	BitboardPosition whiteToMove(DEFAULT_BOARD, EColor::White, { true, true, true, true });
+	BitboardPosition blackToMove(DEFAULT_BOARD, EColor::Black, { true, true, true, true });
+	BitboardPosition noCastle(DEFAULT_BOARD, EColor::White, { false, false, false, false });
+
+	EXPECT_NE(whiteToMove.GetKey(), blackToMove.GetKey());
+	EXPECT_NE(whiteToMove.GetKey(), noCastle.GetKey());
+}
+
+TEST(TestZobrist, Same_Position_Has_Same_Key)
+{
+	ChessGame game;
+
+	std::uint64_t initialKey = game.GetPositionKey();
+
+	game.MakeMove(Position(7, 6), Position(5, 5));
+
+	EXPECT_NE(game.GetPositionKey(), initialKey);
+
+	game.MakeMove(Position(0, 6), Position(2, 5));
+	game.MakeMove(Position(5, 5), Position(7, 6));
+	game.MakeMove(Position(2, 5), Position(0, 6));
+
+	EXPECT_EQ(game.GetPositionKey(), initialKey);
+
+	game.UndoMove();
+	game.MakeMove(Position(2, 5), Position(0, 6));
+
+	EXPECT_EQ(game.GetPositionKey(), initialKey);
+}
+
+TEST(TestZobrist, Threefold_Repetition_Is_Draw)
+{
+	ChessGame game;
+
+	for (int i = 0; i < 2; i++)
+	{
+		EXPECT_FALSE(game.IsDraw());
+
+		game.MakeMove(Position(7, 6), Position(5, 5));
+		game.MakeMove(Position(0, 6), Position(2, 5));
+		game.MakeMove(Position(5, 5), Position(7, 6));
+		game.MakeMove(Position(2, 5), Position(0, 6));
+	}
+
+	EXPECT_TRUE(game.IsDraw());
+}
+
+TEST(TestZobrist, Lost_Castle_Rights_Make_A_New_Position)
+{
+	CharBoard board =
+	{
+		//   0    1    2    3    4    5    6    7
+
+			'K', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 0
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 1
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 2
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 3
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 4
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 5
+			' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',   // 6
+			' ', ' ', ' ', ' ', 'k', ' ', ' ', 'r'    // 7
+	};
+
+	ChessGame game(board, EColor::White, { false, true, false, false });
+
+	// The first rook trip loses the castle right, so the start position is never repeated //
+
+	for (int i = 0; i < 2; i++)
+	{
+		game.MakeMove(Position(7, 7), Position(6, 7));
+		game.MakeMove(Position(0, 0), Position(1, 0));
+		game.MakeMove(Position(6, 7), Position(7, 7));
+		game.MakeMove(Position(1, 0), Position(0, 0));
+	}
+
+	EXPECT_FALSE(game.IsDraw());
+
+	game.MakeMove(Position(7, 7), Position(6, 7));
+	game.MakeMove(Position(0, 0), Position(1, 0));
+	game.MakeMove(Position(6, 7), Position(7, 7));
+	game.MakeMove(Position(1, 0), Position(0, 0));
+
+	EXPECT_TRUE(game.IsDraw());
+}
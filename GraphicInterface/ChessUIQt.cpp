@@ -23,6 +23,8 @@
 #include <QString>
 #include <QStringList>
 
+#include <cstdlib>
+
 
 static EType ToETypeFromQString(const QString& s)
 {
@@ -105,6 +107,20 @@ static std::pair<PieceType, PieceColor> ToPieceFromQChar(const QChar& c)
 	return std::make_pair(type, color);
 }
 
+// Upgrade moves repeat their final position once for every upgrade type //
+static PositionList GetPossibleMovesFrom(const ChessMoveList& moves, const Position& from)
+{
+	PositionList possibleMoves;
+	for (const auto& move : moves)
+	{
+		if (move.from == from && (possibleMoves.empty() || possibleMoves.back() != move.to))
+		{
+			possibleMoves.push_back(move.to);
+		}
+	}
+	return possibleMoves;
+}
+
 static QString FormatTime(int totalMilliseconds)
 {
 	int hours = totalMilliseconds / 3600000;             // 3600000 milliseconds in an hour
@@ -177,6 +193,7 @@ void ChessUIQt::InitializeButtons(QGridLayout* mainGridLayout)
     QPushButton* loadButton = new QPushButton("Load");
     QPushButton* restartButton = new QPushButton("Restart");
     QPushButton* drawButton = new QPushButton("Draw");
+    QPushButton* undoButton = new QPushButton("Undo");
     QPushButton* saveClipboardButton = new QPushButton("Save in Clipboard");
 
     QWidget* buttonContainer = new QWidget();
@@ -186,12 +203,14 @@ void ChessUIQt::InitializeButtons(QGridLayout* mainGridLayout)
     btnGrid->addWidget(loadButton, 0, 1);
     btnGrid->addWidget(restartButton, 0, 2);
     btnGrid->addWidget(drawButton, 1, 0);
-    btnGrid->addWidget(saveClipboardButton, 1, 1, 1, 2);
+    btnGrid->addWidget(undoButton, 1, 1);
+    btnGrid->addWidget(saveClipboardButton, 2, 0, 1, 3);
 
     connect(saveButton, &QPushButton::pressed, this, &ChessUIQt::OnSaveButtonClicked);
     connect(loadButton, &QPushButton::pressed, this, &ChessUIQt::OnLoadButtonClicked);
     connect(restartButton, &QPushButton::pressed, this, &ChessUIQt::OnRestartButtonClicked);
     connect(drawButton, &QPushButton::pressed, this, &ChessUIQt::OnDrawButtonClicked);
+    connect(undoButton, &QPushButton::pressed, this, &ChessUIQt::OnUndoButtonClicked);
     connect(saveClipboardButton, &QPushButton::pressed, this, &ChessUIQt::OnSaveInClipboardButtonClicked);
 
 	QString buttonStyle = "QPushButton {"
@@ -213,6 +232,7 @@ void ChessUIQt::InitializeButtons(QGridLayout* mainGridLayout)
 	loadButton->setStyleSheet(buttonStyle);
 	restartButton->setStyleSheet(buttonStyle);
 	drawButton->setStyleSheet(buttonStyle);
+	undoButton->setStyleSheet(buttonStyle);
 	saveClipboardButton->setStyleSheet(buttonStyle);
 
     buttonContainer->setLayout(btnGrid);
@@ -260,6 +280,11 @@ void ChessUIQt::InitializeTimers(QGridLayout* mainGridLayout)
 	blackTimerLbl->setStyleSheet(labelStyle);
 	whiteTimerLbl->setStyleSheet(labelStyle);
 
+    // Score without search, shown for White as the usual eval bar value //
+    m_EvaluationLabel = new QLabel("Evaluation: +0.00");
+	m_EvaluationLabel->setAlignment(Qt::AlignCenter);
+	m_EvaluationLabel->setStyleSheet(labelStyle);
+
     timerContainer->setFixedWidth(680);
 
     timerGrid->addWidget(blackTimerLbl, 0, 0);
@@ -267,6 +292,7 @@ void ChessUIQt::InitializeTimers(QGridLayout* mainGridLayout)
     timerGrid->addWidget(pauseTimerBtn, 0, 2);
     timerGrid->addWidget(whiteTimerLbl, 0, 3);
     timerGrid->addWidget(m_WhiteTimer, 0, 4);
+    timerGrid->addWidget(m_EvaluationLabel, 1, 2);
 
     timerContainer->setLayout(timerGrid);
 	mainGridLayout->addWidget(timerContainer, 2, 0, 1, 4, Qt::AlignCenter);
@@ -458,19 +484,19 @@ void ChessUIQt::OnButtonClicked(const Position& position)
 		{
 			m_grid[m_selectedCell.value().row][m_selectedCell.value().col]->setSelected(false);
 			m_selectedCell.reset();
-			UnhighlightPossibleMoves(m_game->GetStatus()->GetPossibleMoves(position));
+			UnhighlightPossibleMoves(GetPossibleMovesFrom(m_game->GetStatus()->GetAllPossibleMoves(), position));
 		}
 		else
 		{
 			//TODO COMPLETE ME...
 			try
 			{
-				UnhighlightPossibleMoves(m_game->GetStatus()->GetPossibleMoves(m_selectedCell.value()));
+				UnhighlightPossibleMoves(GetPossibleMovesFrom(m_game->GetStatus()->GetAllPossibleMoves(), m_selectedCell.value()));
 				m_game->MakeMove(m_selectedCell.value(), position);
 			}
 			catch (const OccupiedByOwnPieceException& e)
 			{
-				UnhighlightPossibleMoves(m_game->GetStatus()->GetPossibleMoves(m_selectedCell.value()));
+				UnhighlightPossibleMoves(GetPossibleMovesFrom(m_game->GetStatus()->GetAllPossibleMoves(), m_selectedCell.value()));
 
 				m_grid[m_selectedCell.value().row][m_selectedCell.value().col]->setSelected(false);
 				m_selectedCell.reset();
@@ -479,13 +505,13 @@ void ChessUIQt::OnButtonClicked(const Position& position)
 				m_grid[position.row][position.col]->setSelected(true);
 
 				AppendThrowMessage("");
-				HighlightPossibleMoves(m_game->GetStatus()->GetPossibleMoves(m_selectedCell.value()));
+				HighlightPossibleMoves(GetPossibleMovesFrom(m_game->GetStatus()->GetAllPossibleMoves(), m_selectedCell.value()));
 
 				return;
 			}
 			catch (const ChessException& e)
 			{
-				HighlightPossibleMoves(m_game->GetStatus()->GetPossibleMoves(m_selectedCell.value()));
+				HighlightPossibleMoves(GetPossibleMovesFrom(m_game->GetStatus()->GetAllPossibleMoves(), m_selectedCell.value()));
 				AppendThrowMessage(e.what());
 				return;
 			}
@@ -502,7 +528,7 @@ void ChessUIQt::OnButtonClicked(const Position& position)
 		m_grid[position.row][position.col]->setSelected(true);
 
 		//TODO Show possible moves here
-		HighlightPossibleMoves(m_game->GetStatus()->GetPossibleMoves(position));
+		HighlightPossibleMoves(GetPossibleMovesFrom(m_game->GetStatus()->GetAllPossibleMoves(), position));
 	}
 }
 
@@ -631,6 +657,52 @@ void ChessUIQt::OnDrawButtonClicked()
 	}
 }
 
+void ChessUIQt::OnUndoButtonClicked()
+{
+	try
+	{
+		m_game->UndoMove();
+	}
+	catch (const ChessException& e)
+	{
+		AppendThrowMessage(e.what());
+		return;
+	}
+
+	if (m_selectedCell.has_value())
+	{
+		m_grid[m_selectedCell.value().row][m_selectedCell.value().col]->setSelected(false);
+		m_selectedCell.reset();
+	}
+
+	m_MovesTable->clearContents();
+	m_MovesTable->setRowCount(0);
+	LoadHistory();
+
+	UpdateBoard();
+	UpdateCaptures();
+
+	switch (m_game->GetStatus()->GetCurrentPlayer())
+	{
+	case EColor::Black:
+		UpdateMessage("Waiting for black player");
+		break;
+	case EColor::White:
+		UpdateMessage("Waiting for white player");
+		break;
+	default:
+		break;
+	}
+	if (m_game->GetStatus()->IsCheckState())
+	{
+		QString s = m_MessageLabel->text();
+		s.remove(s.size() - 1, 1);
+		s.append(" - ");
+		s.append("Solve check\n");
+		m_MessageLabel->setText(s);
+	}
+}
+
 void ChessUIQt::OnSaveInClipboardButtonClicked()
 {
 	QString textToCopy;
@@ -1052,6 +1124,7 @@ void ChessUIQt::UpdateBoard()
         }
     }
 
+	UpdateEvaluation();
 }
 
 void ChessUIQt::UpdateCaptures()
@@ -1175,6 +1248,16 @@ void ChessUIQt::UpdateCaptures()
 	}
 }
 
+void ChessUIQt::UpdateEvaluation()
+{
+	int score = m_game->GetStatus()->Evaluate();
+	if (m_game->GetStatus()->GetCurrentPlayer() == EColor::Black)
+		score = -score;
+
+	QString sign = score < 0 ? "-" : "+";
+	m_EvaluationLabel->setText("Evaluation: " + sign + QString::number(std::abs(score) / 100.0, 'f', 2));
+}
+
 void ChessUIQt::HighlightPossibleMoves(const PositionList& possibleMoves)
 {
     for (const auto& position : possibleMoves) 
@@ -1286,6 +1369,13 @@ void ChessUIQt::OnMoveMade(Position init, Position fin)
 
     m_grid[init.row][init.col]->setPiece(voidPiece);
 
+    // At en passant the captured pawn is not on the final square //
+    Position passedPawnPos(init.row, fin.col);
+    if (!m_game->GetStatus()->GetIPiecePtr(passedPawnPos))
+    {
+        m_grid[passedPawnPos.row][passedPawnPos.col]->setPiece(voidPiece);
+    }
+
 	//UpdateBoard();
 
 	switch (m_game->GetStatus()->GetCurrentPlayer())
@@ -1301,6 +1391,7 @@ void ChessUIQt::OnMoveMade(Position init, Position fin)
 	}
 
 	UpdateCaptures();
+	UpdateEvaluation();
 }
 
 void ChessUIQt::OnGameOver(EGameResult result)
@@ -1358,6 +1449,7 @@ void ChessUIQt::OnPawnUpgrade(Position pos)
     upgradePiece.first = ToPieceTypeFromEType(upgradeType);
 
 	m_grid[pos.row][pos.col]->setPiece(upgradePiece);
+	UpdateEvaluation();
 
 	/*switch (m_game->GetStatus()->GetCurrentPlayer())
 	{
@@ -36,6 +36,7 @@ public:
     void UpdateHistory(const std::string& move);
     void UpdateBoard();
     void UpdateCaptures();
+    void UpdateEvaluation();
 
     void UpdateMessage(const QString& message);
     void AppendThrowMessage(const QString& message);
@@ -65,6 +66,7 @@ public slots:
     void OnLoadButtonClicked();
     void OnRestartButtonClicked();
     void OnDrawButtonClicked();
+    void OnUndoButtonClicked();
     void OnSaveInClipboardButtonClicked();
     void OnPauseButtonClicked();
     void OnHistoryClicked(QTableWidgetItem* item);
@@ -94,6 +96,7 @@ private:
     QLabel* m_MessageLabel;
     QTableWidget* m_MovesTable;
     QLabel* m_BlackTimer, *m_WhiteTimer;
+    QLabel* m_EvaluationLabel;
 
     IChessGame* m_game;
 };
\ No newline at end of file